@@ -0,0 +1,390 @@
+#include <benchmark/benchmark.h>
+
+#include "conduit/defines.h"
+
+#include "conduit/ecs/commandBuffer.h"
+#include "conduit/ecs/entity.h"
+#include "conduit/ecs/prefab.h"
+#include "conduit/ecs/world.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
+
+/*
+ *
+ *      Benchmark components and helpers
+ *
+ * */
+
+// Generic benchmark component,
+// the index is used to generate distinct component types
+template <usize Index>
+struct BenchComp {
+    BenchComp() : value(0) {};
+    BenchComp(u32 value) : value(value) {};
+
+    u32 value;
+    u32 padding[3];
+};
+
+// Fixed seed used by all the random benchmarks
+constexpr u32 bench_seed = 42;
+
+// Create the given number of entities
+std::vector<Entity> createEntities(World& world, usize count)
+{
+    std::vector<Entity> entities;
+    entities.reserve(count);
+
+    for (usize i = 0; i < count; i++) {
+        entities.push_back(world.newEntity());
+    }
+
+    return entities;
+}
+
+// Attach one component of each of the given types to all the entities
+template <usize... Is>
+void attachAll(
+    World& world,
+    std::vector<Entity>& entities,
+    std::index_sequence<Is...>
+) {
+    for (auto entity : entities) {
+        (world.attachComponent<BenchComp<Is>>(entity, entity.id()), ...);
+    }
+}
+
+// Create and drop a query on the given component types
+template <usize... Is>
+usize runQuery(World& world, std::index_sequence<Is...>)
+{
+    auto query = world.getQuery<BenchComp<Is>...>();
+    return query.size();
+}
+
+/*
+ *
+ *      Attach and detach benchmarks
+ *
+ * */
+
+// Attach components to entities in crescent id order
+static void BM_AttachSequential(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        World world;
+        std::vector<Entity> entities = createEntities(world, count);
+        state.ResumeTiming();
+
+        for (auto entity : entities) {
+            world.attachComponent<BenchComp<0>>(entity, entity.id());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_AttachSequential)
+    ->RangeMultiplier(10)->Range(1'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+// Attach components to entities in random id order,
+// every attach insert in the middle of the buffer so the range is smaller
+static void BM_AttachRandom(benchmark::State& state)
+{
+    usize count = state.range(0);
+    std::mt19937 rng(bench_seed);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        World world;
+        std::vector<Entity> entities = createEntities(world, count);
+        std::shuffle(entities.begin(), entities.end(), rng);
+        state.ResumeTiming();
+
+        for (auto entity : entities) {
+            world.attachComponent<BenchComp<0>>(entity, entity.id());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_AttachRandom)
+    ->RangeMultiplier(10)->Range(1'000, 100'000)
+    ->Unit(benchmark::kMillisecond);
+
+// Detach components starting from the last entity
+static void BM_DetachSequential(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        World world;
+        std::vector<Entity> entities = createEntities(world, count);
+        attachAll(world, entities, std::index_sequence<0>{});
+        state.ResumeTiming();
+
+        for (auto it = entities.rbegin(); it != entities.rend(); it++) {
+            world.detachComponent<BenchComp<0>>(*it);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DetachSequential)
+    ->RangeMultiplier(10)->Range(1'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+// Detach components in random entity order
+static void BM_DetachRandom(benchmark::State& state)
+{
+    usize count = state.range(0);
+    std::mt19937 rng(bench_seed);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        World world;
+        std::vector<Entity> entities = createEntities(world, count);
+        attachAll(world, entities, std::index_sequence<0>{});
+        std::shuffle(entities.begin(), entities.end(), rng);
+        state.ResumeTiming();
+
+        for (auto entity : entities) {
+            world.detachComponent<BenchComp<0>>(entity);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DetachRandom)
+    ->RangeMultiplier(10)->Range(1'000, 100'000)
+    ->Unit(benchmark::kMillisecond);
+
+/*
+ *
+ *      Query benchmarks
+ *
+ * */
+
+// Rebuild the query every iteration by changing one of the buffers
+template <usize CompCount>
+static void BM_QueryCold(benchmark::State& state)
+{
+    constexpr auto indices = std::make_index_sequence<CompCount>{};
+    usize count = state.range(0);
+
+    World world;
+    std::vector<Entity> entities = createEntities(world, count);
+    attachAll(world, entities, indices);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        world.detachComponent<BenchComp<0>>(entities.back());
+        world.attachComponent<BenchComp<0>>(entities.back(), 0);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(runQuery(world, indices));
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_QueryCold<1>)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QueryCold<2>)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QueryCold<3>)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QueryCold<4>)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QueryCold<5>)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QueryCold<6>)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+
+// Get an already cached query
+template <usize CompCount>
+static void BM_QueryWarm(benchmark::State& state)
+{
+    constexpr auto indices = std::make_index_sequence<CompCount>{};
+    usize count = state.range(0);
+
+    World world;
+    std::vector<Entity> entities = createEntities(world, count);
+    attachAll(world, entities, indices);
+
+    runQuery(world, indices);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(runQuery(world, indices));
+    }
+}
+BENCHMARK(BM_QueryWarm<1>)->Arg(100'000);
+BENCHMARK(BM_QueryWarm<2>)->Arg(100'000);
+BENCHMARK(BM_QueryWarm<3>)->Arg(100'000);
+BENCHMARK(BM_QueryWarm<4>)->Arg(100'000);
+BENCHMARK(BM_QueryWarm<5>)->Arg(100'000);
+BENCHMARK(BM_QueryWarm<6>)->Arg(100'000);
+
+// Iterate over all the elements of a two components query
+static void BM_QueryIteration(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    World world;
+    std::vector<Entity> entities = createEntities(world, count);
+    attachAll(world, entities, std::index_sequence<0, 1>{});
+
+    for (auto _ : state) {
+        auto query = world.getQuery<BenchComp<0>, BenchComp<1>>();
+
+        u64 sum = 0;
+        for (auto element : query) {
+            sum += element.get<BenchComp<0>>().value;
+            sum += element.get<BenchComp<1>>().value;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_QueryIteration)
+    ->RangeMultiplier(10)->Range(1'000, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
+
+/*
+ *
+ *      Command buffer and entity benchmarks
+ *
+ * */
+
+// Record attach commands and play them back on the world
+static void BM_CmdBufferPlayback(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        World world;
+        ECSCmdBuffer cmd_buffer;
+
+        std::vector<Entity> entities = createEntities(world, count);
+        for (auto entity : entities) {
+            cmd_buffer.attachComponent<BenchComp<0>>(entity, entity.id());
+        }
+        state.ResumeTiming();
+
+        world.executeCmdBuffer(cmd_buffer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_CmdBufferPlayback)
+    ->RangeMultiplier(10)->Range(1'000, 1'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+// Delete entities with the given number of components types attached
+template <usize CompCount>
+static void BM_DeleteEntity(benchmark::State& state)
+{
+    constexpr auto indices = std::make_index_sequence<CompCount>{};
+    usize count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        World world;
+        std::vector<Entity> entities = createEntities(world, count);
+        attachAll(world, entities, indices);
+        state.ResumeTiming();
+
+        for (auto it = entities.rbegin(); it != entities.rend(); it++) {
+            world.deleteEntity(*it);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DeleteEntity<1>)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DeleteEntity<4>)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DeleteEntity<8>)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DeleteEntity<16>)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+
+// Merge a streamed world with the given number of 
+// entities and four components types in the main world
+static void BM_WorldMerge(benchmark::State& state)
+{
+    constexpr auto indices = std::make_index_sequence<4>{};
+    usize count = state.range(0);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto world = std::make_unique<World>();
+        std::vector<Entity> entities = createEntities(*world, count);
+        attachAll(*world, entities, indices);
+
+        auto streamed = std::make_unique<World>();
+        std::vector<Entity> streamed_entities = 
+            createEntities(*streamed, count);
+        attachAll(*streamed, streamed_entities, indices);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(world->merge(std::move(*streamed)));
+
+        // Don't measure the worlds destruction
+        state.PauseTiming();
+        world.reset();
+        streamed.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_WorldMerge)
+    ->RangeMultiplier(10)->Range(1'000, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
+
+// Instantiate a four components prefab the given number of times
+static void BM_PrefabInstantiate(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    Prefab prefab;
+    prefab.addComponent<BenchComp<0>>(0);
+    prefab.addComponent<BenchComp<1>>(1);
+    prefab.addComponent<BenchComp<2>>(2);
+    prefab.addComponent<BenchComp<3>>(3);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto world = std::make_unique<World>();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(world->instantiate(prefab, count));
+
+        // Don't measure the world destruction
+        state.PauseTiming();
+        world.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_PrefabInstantiate)
+    ->RangeMultiplier(10)->Range(1'000, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,389 @@
+#include <benchmark/benchmark.h>
+
+#include "conduit/defines.h"
+
+#include "conduit/events/eventBus.h"
+#include "conduit/events/eventReader.h"
+#include "conduit/events/eventWriter.h"
+
+#include "conduit/internal/core/threadPool.h"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
+
+/*
+ *
+ *      Benchmark events and helpers
+ *
+ * */
+
+// Generic benchmark event,
+// the index is used to generate distinct event types
+template <usize Index>
+struct BenchEvent {
+    u32 value;
+    u32 padding[3];
+};
+
+// Maximum number of distinct event types used by the update benchmarks
+constexpr usize max_bench_types = 1000;
+
+// Function sending an event of a single benchmark type
+using SendFn = void (*)(EventWriter&);
+
+// Return a table of functions sending one event of every benchmark type
+template <usize... Is>
+std::array<SendFn, sizeof...(Is)> makeSendTable(std::index_sequence<Is...>)
+{
+    return {
+        +[](EventWriter& writer) {
+            writer.send(BenchEvent<Is> { .value = Is, .padding = {} });
+        }...
+    };
+}
+
+// Send functions of all the benchmark types
+static const auto send_table = makeSendTable(
+    std::make_index_sequence<max_bench_types>{}
+);
+
+// Register the first given number of benchmark types on the bus
+void registerTypes(EventBus& bus, usize count)
+{
+    EventWriter writer = bus.getEventWriter();
+
+    // Sending an event creates the type buffer,
+    // the updates expire the events and leave the buffers empty
+    for (usize i = 0; i < count; i++) {
+        send_table[i](writer);
+    }
+
+    bus.update();
+    bus.update();
+}
+
+/*
+ *
+ *      Event writer benchmarks
+ *
+ * */
+
+// Send events from a single thread with the bus writer
+static void BM_WriterSend(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+
+    for (auto _ : state) {
+        for (usize i = 0; i < count; i++) {
+            writer.send(BenchEvent<0> { .value = u32(i), .padding = {} });
+        }
+
+        state.PauseTiming();
+        bus.update();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_WriterSend)
+    ->RangeMultiplier(10)->Range(100, 100'000)
+    ->Unit(benchmark::kMicrosecond);
+
+// Send events from a single thread with a cached typed writer
+static void BM_TypedWriterSend(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    EventBus bus;
+    auto writer = bus.getTypedEventWriter<BenchEvent<0>>();
+
+    for (auto _ : state) {
+        for (usize i = 0; i < count; i++) {
+            writer.send(BenchEvent<0> { .value = u32(i), .padding = {} });
+        }
+
+        state.PauseTiming();
+        bus.update();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_TypedWriterSend)
+    ->RangeMultiplier(10)->Range(100, 100'000)
+    ->Unit(benchmark::kMicrosecond);
+
+// Send events of the same type from multiple threads, the first
+// thread updates the bus concurrently like the engine main loop
+static void BM_WriterSendThreaded(benchmark::State& state)
+{
+    constexpr usize count = 1'000;
+
+    // Shared by all the benchmark threads
+    static EventBus bus;
+    auto writer = bus.getTypedEventWriter<BenchEvent<0>>();
+
+    for (auto _ : state) {
+        for (usize i = 0; i < count; i++) {
+            writer.send(BenchEvent<0> { .value = u32(i), .padding = {} });
+        }
+
+        if (state.thread_index() == 0)
+            bus.update();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_WriterSendThreaded)
+    ->Threads(1)->Threads(2)->Threads(4)->Threads(8)
+    ->UseRealTime();
+
+// Send events of the same type from multiple threads without locking
+// the event buffer, the events are published by the bus update
+static void BM_WriterSendConcurrentThreaded(benchmark::State& state)
+{
+    constexpr usize count = 1'000;
+
+    // Shared by all the benchmark threads
+    static EventBus bus;
+    auto writer = bus.getTypedEventWriter<BenchEvent<0>>();
+
+    for (auto _ : state) {
+        for (usize i = 0; i < count; i++) {
+            writer.sendConcurrent(
+                BenchEvent<0> { .value = u32(i), .padding = {} }
+            );
+        }
+
+        if (state.thread_index() == 0)
+            bus.update();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_WriterSendConcurrentThreaded)
+    ->Threads(1)->Threads(2)->Threads(4)->Threads(8)
+    ->UseRealTime();
+
+/*
+ *
+ *      Event reader benchmarks
+ *
+ * */
+
+// Iterate over the events one at the time with the reader iterator
+static void BM_ReaderIterate(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    EventBus bus;
+    auto writer = bus.getTypedEventWriter<BenchEvent<0>>();
+
+    for (usize i = 0; i < count; i++) {
+        writer.send(BenchEvent<0> { .value = u32(i), .padding = {} });
+    }
+    bus.update();
+
+    for (auto _ : state) {
+        // A new reader reads all the events again
+        auto reader = bus.getEventReader<BenchEvent<0>>();
+
+        u64 sum = 0;
+        for (auto& event : reader) {
+            sum += event.value;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ReaderIterate)
+    ->RangeMultiplier(10)->Range(100, 100'000)
+    ->Unit(benchmark::kMicrosecond);
+
+// Read all the events as a batch locking the buffer once
+static void BM_ReaderReadAll(benchmark::State& state)
+{
+    usize count = state.range(0);
+
+    EventBus bus;
+    auto writer = bus.getTypedEventWriter<BenchEvent<0>>();
+
+    for (usize i = 0; i < count; i++) {
+        writer.send(BenchEvent<0> { .value = u32(i), .padding = {} });
+    }
+    bus.update();
+
+    for (auto _ : state) {
+        auto reader = bus.getEventReader<BenchEvent<0>>();
+
+        u64 sum = 0;
+        reader.readAll().forEach([&sum](const BenchEvent<0>& event) {
+            sum += event.value;
+        });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ReaderReadAll)
+    ->RangeMultiplier(10)->Range(100, 100'000)
+    ->Unit(benchmark::kMicrosecond);
+
+/*
+ *
+ *      Event bus update benchmarks
+ *
+ * */
+
+// Update a bus with the given number of registered types,
+// only one type receives an event every update
+static void BM_BusUpdateIdleTypes(benchmark::State& state)
+{
+    usize type_count = state.range(0);
+
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+    registerTypes(bus, type_count);
+
+    for (auto _ : state) {
+        send_table[0](writer);
+        bus.update();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["types"] = type_count;
+}
+BENCHMARK(BM_BusUpdateIdleTypes)
+    ->Arg(1)->Arg(10)->Arg(100)->Arg(1'000);
+
+// Update a bus with the given number of registered types,
+// all the types receive an event every update
+static void BM_BusUpdateActiveTypes(benchmark::State& state)
+{
+    usize type_count = state.range(0);
+
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+    registerTypes(bus, type_count);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (usize i = 0; i < type_count; i++) {
+            send_table[i](writer);
+        }
+        state.ResumeTiming();
+
+        bus.update();
+    }
+
+    state.SetItemsProcessed(state.iterations() * type_count);
+    state.counters["types"] = type_count;
+}
+BENCHMARK(BM_BusUpdateActiveTypes)
+    ->Arg(1)->Arg(10)->Arg(100)->Arg(1'000);
+
+/*
+ *
+ *      Callback dispatch benchmarks
+ *
+ * */
+
+// Number of events dispatched by every callback benchmark update
+constexpr usize dispatch_event_count = 1'000;
+
+// Dispatch the events to the given number of serial callbacks
+static void BM_CallbackDispatchSerial(benchmark::State& state)
+{
+    usize callback_count = state.range(0);
+
+    EventBus bus;
+    auto writer = bus.getTypedEventWriter<BenchEvent<0>>();
+
+    u64 sum = 0;
+    for (usize i = 0; i < callback_count; i++) {
+        bus.addCallback<BenchEvent<0>>([&sum](const BenchEvent<0>* event) {
+            sum += event->value;
+        });
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (usize i = 0; i < dispatch_event_count; i++) {
+            writer.send(BenchEvent<0> { .value = u32(i), .padding = {} });
+        }
+        state.ResumeTiming();
+
+        bus.update();
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(
+        state.iterations() * callback_count * dispatch_event_count
+    );
+}
+BENCHMARK(BM_CallbackDispatchSerial)
+    ->Arg(1)->Arg(10)->Arg(100)
+    ->Unit(benchmark::kMicrosecond);
+
+// Dispatch the events to the given number of thread safe callbacks
+// running on the thread pool
+static void BM_CallbackDispatchThreadSafe(benchmark::State& state)
+{
+    usize callback_count = state.range(0);
+
+    ThreadPool thread_pool;
+    EventBus bus;
+    bus.setThreadPool(&thread_pool);
+
+    auto writer = bus.getTypedEventWriter<BenchEvent<0>>();
+
+    std::vector<u64> sums(callback_count, 0);
+    for (usize i = 0; i < callback_count; i++) {
+        bus.addCallback<BenchEvent<0>>(
+            [&sum = sums[i]](const BenchEvent<0>* event) {
+                benchmark::DoNotOptimize(sum += event->value);
+            },
+            CallbackMode::ThreadSafe
+        );
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (usize i = 0; i < dispatch_event_count; i++) {
+            writer.send(BenchEvent<0> { .value = u32(i), .padding = {} });
+        }
+        state.ResumeTiming();
+
+        bus.update();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * callback_count * dispatch_event_count
+    );
+}
+BENCHMARK(BM_CallbackDispatchThreadSafe)
+    ->Arg(1)->Arg(10)->Arg(100)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
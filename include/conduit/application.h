@@ -4,12 +4,16 @@
 #include "conduit/defines.h"
 
 #include "conduit/config/engineConfig.h"
+#include "conduit/coroutine.h"
 
 #include "conduit/ecs/world.h"
 #include "conduit/events/eventBus.h"
+#include "conduit/events/eventRecorder.h"
+#include "conduit/events/inputChannel.h"
 #include "conduit/renderer/renderer.h"
 #include "conduit/window/window.h"
 #include "conduit/internal/core/deleteQueue.h"
+#include "conduit/internal/core/threadPool.h"
 
 #include "conduit/assets/assetsManager.h"
 #include "conduit/assets/mesh.h"
@@ -66,20 +70,34 @@ private:
 protected:
     bool m_run_application;
 
+    // Engine worker threads, declared first to outlive its users
+    ThreadPool m_thread_pool;
+
     // Asset manager
     AssetsManager<Shader, Texture, Mesh> m_asset_manager;
 
     // Application event bus
     EventBus m_event_bus;
 
+    // Optional event log recorder and player
+    std::unique_ptr<EventRecorder> m_event_recorder;
+    std::unique_ptr<EventPlayer> m_event_player;
+
     // ECS world
     World m_ecs_world;
 
+    // Timestamped input events produced by the window,
+    // drained before every event bus update
+    InputChannel m_input_channel;
+
     // Application window handle
     std::unique_ptr<Window> m_window;
     // Application renderer handle
     std::unique_ptr<Renderer> m_renderer;
 
+    // Resume the coroutines waiting for a frame or a time interval
+    CoroutineScheduler m_coroutine_scheduler;
+
 private:
     // Application deleter queue
     DeleteQueue m_delete_queue;
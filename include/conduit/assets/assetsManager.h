@@ -5,8 +5,13 @@
 
 #include "conduit/internal/assets/assetParser.h"
 #include "conduit/internal/assets/assetsCache.h"
+#include "conduit/internal/core/fileWatcher.h"
+#include "conduit/internal/core/threadPool.h"
 
+#include <chrono>
+#include <memory>
 #include <string_view>
+#include <unordered_set>
 #include <vector>
 
 namespace cndt {
@@ -16,33 +21,73 @@ template <typename... AssetTypes>
 class AssetsManager {
 public:
     // Create an asset manager using only the builtin asset table
-    AssetsManager() : m_parser(), m_cache(), m_tables_paths() { };
+    AssetsManager() : 
+        m_parser(), m_cache(), m_tables_paths(), 
+        m_thread_pool_p(nullptr), m_file_watcher_p() { };
     // Create an asset manager using 
     // the builtin asset table and a user defined asset table
     AssetsManager(std::filesystem::path asset_table_path) :
         m_parser({asset_table_path}), m_cache(),
-        m_tables_paths({asset_table_path}) { };
+        m_tables_paths({asset_table_path}), m_thread_pool_p(nullptr),
+        m_file_watcher_p() { };
     // Create an asset manager using 
     // the builtin asset table and list of user defined asset tables
     AssetsManager(std::vector<std::filesystem::path> asset_table_paths) :
         m_parser(asset_table_paths), m_cache(), 
-        m_tables_paths(asset_table_paths) { };
+        m_tables_paths(asset_table_paths), m_thread_pool_p(nullptr),
+        m_file_watcher_p() { };
     
     // Get an asset handle from the given asset name
     template<typename AssetType>
     AssetHandle<AssetType> get(std::string_view asset_name);
 
+    // Get an asset handle from the given asset name without blocking,
+    // the asset is loaded on the thread pool and the handle become 
+    // available and report an update when the loading is complete
+    template<typename AssetType>
+    AssetHandle<AssetType> getAsync(std::string_view asset_name);
+
+    // Set the thread pool used to load the asynchronous assets and reload
+    // the cache, the pool must outlive the manager, null run synchronously
+    void setThreadPool(ThreadPool* thread_pool_p) 
+    { 
+        m_thread_pool_p = thread_pool_p; 
+    }
+
     // Update all the cached asset in the asset manager.
-    // This function reload all the asset from memory
-    // and can be very slow should be called only when needed
+    // This function reload all the asset from memory on the thread 
+    // pool, it blocks until done and should be called only when needed
     void updateAssets();
 
+    // Watch the asset tables and the cached assets source files,
+    // the changed assets are reloaded by updateChangedAssets
+    void enableHotReload(
+        std::chrono::milliseconds debounce = std::chrono::milliseconds(200)
+    );
+
+    // Reload only the assets whose source files or table entries changed,
+    // rapid changes are coalesced and reloaded once they settle
+    //
+    // Does nothing if hot reload is not enabled
+    void updateChangedAssets();
+
+private:
+    // Watch the source files of the given asset if hot reload is enabled
+    template<typename AssetType>
+    void watchSources(const AssetInfo<AssetType>& info);
+
 private:
     internal::AssetParser<AssetTypes...> m_parser;
     internal::AssetsCache<AssetTypes...> m_cache;
 
     // Store the user asset tables paths
     std::vector<std::filesystem::path> m_tables_paths;
+
+    // Thread pool running the asynchronous assets loading and reload
+    ThreadPool* m_thread_pool_p;
+
+    // Asset tables and source files watcher, null if hot reload is disabled
+    std::unique_ptr<FileWatcher> m_file_watcher_p;
 };
     
 // Get an asset handle from the given asset name or file path
@@ -54,12 +99,34 @@ AssetHandle<AssetType> AssetsManager<AssetTypes...>::get(
 ) {
     auto info = m_parser.template getInfo<AssetType>(asset_name);
 
+    if (info.has_value())
+        watchSources(info.value());
+
     return m_cache.template getHandle<AssetType>(
         asset_name,
         info
     );
 }
 
+// Get an asset handle from the given asset name without blocking
+// If the asset is not found return an handle to an unavailable asset
+template <typename... AssetTypes>
+template<typename AssetType>
+AssetHandle<AssetType> AssetsManager<AssetTypes...>::getAsync(
+    std::string_view asset_name
+) {
+    auto info = m_parser.template getInfo<AssetType>(asset_name);
+
+    if (info.has_value())
+        watchSources(info.value());
+
+    return m_cache.template getHandleAsync<AssetType>(
+        asset_name,
+        info,
+        m_thread_pool_p
+    );
+}
+
 // Update all the cached asset in the asset manager.
 template <typename... AssetTypes>
 void AssetsManager<AssetTypes...>::updateAssets()
@@ -68,7 +135,77 @@ void AssetsManager<AssetTypes...>::updateAssets()
     m_parser = internal::AssetParser<AssetTypes...>(m_tables_paths);
 
     // Update the assets cache
-    m_cache.updateAssets(m_parser);
+    m_cache.updateAssets(m_parser, m_thread_pool_p);
+
+    // Watch the new source files if hot reload is enabled
+    if (m_file_watcher_p != nullptr)
+        m_cache.forEachInfo([this](const auto& info) { watchSources(info); });
+}
+
+// Watch the asset tables and the cached assets source files
+template <typename... AssetTypes>
+void AssetsManager<AssetTypes...>::enableHotReload(
+    std::chrono::milliseconds debounce
+) {
+    m_file_watcher_p = std::make_unique<FileWatcher>(debounce);
+
+    for (auto& table_path : m_parser.tablePaths()) {
+        m_file_watcher_p->watch(table_path);
+    }
+
+    // Watch the assets already in the cache
+    m_cache.forEachInfo([this](const auto& info) { watchSources(info); });
+}
+
+// Reload only the assets whose source files or table entries changed
+template <typename... AssetTypes>
+void AssetsManager<AssetTypes...>::updateChangedAssets()
+{
+    if (m_file_watcher_p == nullptr)
+        return;
+
+    std::vector<std::filesystem::path> changed_paths = 
+        m_file_watcher_p->poll();
+
+    if (changed_paths.empty())
+        return;
+
+    // Diff the changed tables, the other files are asset sources
+    internal::AssetNameSets<AssetTypes...> changed_names;
+    std::unordered_set<std::string> changed_files;
+
+    for (auto& path : changed_paths) {
+        if (m_parser.updateTable(path, changed_names))
+            continue;
+
+        log::core::debug("Asset source file changed: \"{}\"", path.string());
+        changed_files.insert(path.string());
+    }
+
+    m_cache.updateChangedAssets(
+        m_parser,
+        changed_names,
+        changed_files,
+        m_thread_pool_p
+    );
+
+    // The changed table entries may point to new source files
+    m_cache.forEachInfo([this](const auto& info) { watchSources(info); });
+}
+
+// Watch the source files of the given asset if hot reload is enabled
+template <typename... AssetTypes>
+template <typename AssetType>
+void AssetsManager<AssetTypes...>::watchSources(
+    const AssetInfo<AssetType>& info
+) {
+    if (m_file_watcher_p == nullptr)
+        return;
+
+    for (auto& path : assetSourcePaths<AssetType>(info)) {
+        if (!path.empty())
+            m_file_watcher_p->watch(path);
+    }
 }
 
 } // namespace cndt
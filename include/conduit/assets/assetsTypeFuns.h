@@ -3,6 +3,9 @@
 
 #include "conduit/assets/assetInfo.h"
 
+#include <filesystem>
+#include <vector>
+
 #include <nlohmann/json.hpp>
 
 namespace cndt {
@@ -29,6 +32,15 @@ AssetInfo<AssetType> parseTableEntry(std::string_view, nlohmann::json);
 template <typename AssetType>
 std::unique_ptr<AssetType> loadAsset(AssetInfo<AssetType>&); 
 
+// Template declaration for asset source files function
+//
+// Return the paths of the files the asset is loaded from,
+// used to reload the asset when one of the files changes
+template <typename AssetType>
+std::vector<std::filesystem::path> assetSourcePaths(
+    const AssetInfo<AssetType>&
+);
+
 } // namespace cndt
 
 #endif
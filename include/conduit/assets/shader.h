@@ -122,7 +122,7 @@ public:
     // Get the vulkan spv code path
     std::filesystem::path pathVkSpv() const { return m_vk_spv; }
     // Get the vulkan glsl code path
-    std::filesystem::path pathVkGlsl() const { return m_vk_spv; }
+    std::filesystem::path pathVkGlsl() const { return m_vk_glsl; }
     
     // Get the OpenGL glsl code
     std::filesystem::path pathGlGlsl() const { return m_gl_glsl; }
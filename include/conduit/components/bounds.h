@@ -0,0 +1,32 @@
+#ifndef CNDT_COMPONENT_BOUNDS_H
+#define CNDT_COMPONENT_BOUNDS_H
+
+#include <glm/glm.hpp>
+
+namespace cndt {
+
+// Conduit axis aligned bounds component,
+// the box is centered on the entity transform position
+class Bounds {
+public:
+    Bounds() :
+        m_half_extents(0, 0, 0)
+    { };
+    Bounds(glm::vec3 half_extents) :
+        m_half_extents(half_extents)
+    { };
+
+    // Return a reference to the box half size on each axis
+    glm::vec3& halfExtents() { return m_half_extents; }
+
+    // Return the box half size on each axis
+    glm::vec3 getHalfExtents() const { return m_half_extents; }
+
+protected:
+    // Store the box half size on each axis
+    glm::vec3 m_half_extents;
+};
+
+} // namespace cndt
+
+#endif
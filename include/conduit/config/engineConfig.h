@@ -53,12 +53,30 @@ struct EngineConfig {
     // Store the asset manager settings
     struct Assets {
         Assets() :
-            user_table_path(std::nullopt)
+            user_table_path(std::nullopt),
+            hot_reload(std::nullopt)
         { }
 
         std::optional<std::filesystem::path> user_table_path;
+
+        // Reload the assets when their source files or table entries change
+        std::optional<bool> hot_reload;
     } assets;
 
+    // Event recording and replay settings
+    struct Events {
+        Events() :
+            record_path(std::nullopt),
+            replay_path(std::nullopt)
+        { }
+
+        // Record the engine events to the given log file
+        std::optional<std::filesystem::path> record_path;
+
+        // Replay the given event log instead of pooling the window events
+        std::optional<std::filesystem::path> replay_path;
+    } events;
+
 public:
     // Default config path 
     static constexpr const char* default_config_path = 
@@ -0,0 +1,157 @@
+#ifndef CNDT_COROUTINE_H
+#define CNDT_COROUTINE_H
+
+#include "conduit/defines.h"
+#include "conduit/time.h"
+
+#include <coroutine>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace cndt {
+
+/*
+ *
+ *      Task definition
+ *
+ * */
+
+// Fire and forget coroutine, the coroutine starts immediately and its
+// frame is released when it completes. While suspended the coroutine is
+// owned by the scheduler or the event bus it's waiting on, and it's
+// destroyed without being resumed if they are deleted first
+class Task {
+public:
+    struct promise_type {
+        Task get_return_object() noexcept { return Task(); }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept { }
+
+        // Log the exceptions escaping the coroutine body
+        void unhandled_exception();
+    };
+};
+
+/*
+ *
+ *      Coroutine scheduler definition
+ *
+ * */
+
+// Resume the coroutines waiting for a frame or a time interval,
+// the scheduler must be updated once per frame by the main loop
+class CoroutineScheduler {
+    using Handle = std::coroutine_handle<>;
+
+public:
+    CoroutineScheduler();
+    ~CoroutineScheduler();
+
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    // Resume the coroutines waiting for the next frame
+    // and the ones whose wait time expired
+    void update();
+
+    // Destroy all the suspended coroutines without resuming them
+    void clear();
+
+    // Make the scheduler the one used by nextFrame and seconds
+    // on the calling thread
+    void makeCurrent();
+
+    // Return the scheduler used by the calling thread, can be null
+    static CoroutineScheduler* current();
+
+    // Resume the coroutine at the next update
+    void waitFrame(Handle handle);
+
+    // Resume the coroutine at the first update after the given delay
+    void waitSeconds(f64 delay, Handle handle);
+
+    // Return the number of suspended coroutines
+    usize size() const;
+
+private:
+    // Coroutine waiting for a point in time,
+    // the order keeps the waits with the same time stable
+    struct TimedWait {
+        u64 wake_ms;
+        u64 order;
+        Handle handle;
+
+        bool operator>(const TimedWait& other) const
+        {
+            if (wake_ms != other.wake_ms)
+                return wake_ms > other.wake_ms;
+
+            return order > other.order;
+        }
+    };
+
+private:
+    // Coroutines waiting for the next frame
+    std::vector<Handle> m_frame_waits;
+
+    // Coroutines waiting for a point in time
+    std::priority_queue<
+        TimedWait,
+        std::vector<TimedWait>,
+        std::greater<TimedWait>
+    > m_timed_waits;
+    u64 m_wait_order;
+
+    // Coroutines being resumed during the update
+    std::vector<Handle> m_resuming;
+
+    time::Clock m_clock;
+};
+
+/*
+ *
+ *      Scheduler awaitables
+ *
+ * */
+
+// Suspend the coroutine until the next scheduler update
+class FrameAwaiter {
+public:
+    bool await_ready() const noexcept { return false; }
+
+    // Return false to continue if there is no current scheduler
+    bool await_suspend(std::coroutine_handle<> handle);
+
+    void await_resume() const noexcept { }
+};
+
+// Suspend the coroutine until the given time has passed
+class TimeAwaiter {
+public:
+    TimeAwaiter(f64 delay) : m_delay(delay) { }
+
+    bool await_ready() const noexcept { return false; }
+
+    // Return false to continue if there is no current scheduler
+    bool await_suspend(std::coroutine_handle<> handle);
+
+    void await_resume() const noexcept { }
+
+private:
+    // Wait time in seconds
+    f64 m_delay;
+};
+
+// Await the next frame on the current thread scheduler
+inline FrameAwaiter nextFrame() { return FrameAwaiter(); }
+
+// Await the given number of seconds on the current thread scheduler
+inline TimeAwaiter seconds(f64 delay) { return TimeAwaiter(delay); }
+
+} // namespace cndt
+
+#endif
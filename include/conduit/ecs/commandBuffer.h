@@ -4,25 +4,35 @@
 #include "conduit/ecs/entity.h"
 #include "conduit/ecs/world.h"
 
-#include <functional>
+#include "conduit/internal/core/inplaceFunction.h"
+
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace cndt {
 
+// Inline storage size of the ECS commands captures
+constexpr usize ecs_command_capacity = 64;
+
 // Store entity component system commands
 class ECSCmdBuffer {
     friend class World;
     
 public:
+    // Command function type, the captures are stored inline
+    using CommandFn = InplaceFunction<void(World*), ecs_command_capacity>;
+
     // Store a single ECS command
     struct Command {
-        Command(std::function<void(World*)> cmd) : m_command(cmd) { }
+        Command(CommandFn cmd) : m_command(std::move(cmd)) { }
         
         // Run the stored command
         void executeCommand(World *world_p) { m_command(world_p); };
 
     private:
-        std::function<void(World*)> m_command;
+        CommandFn m_command;
     };
     
 public:
@@ -47,6 +57,11 @@ public:
     void detachComponent(Entity entity); 
         
 private:
+    // Append a command, the commands whose captures don't fit
+    // the inline storage are moved to the heap
+    template <typename Fn>
+    void pushCommand(Fn&& command_fn);
+
     // Execute all the commands for the given world
     void runCommands(World *world_p);
 
@@ -55,12 +70,34 @@ private:
     std::vector<Command> m_commands;
 };
 
+// Append a command, the commands whose captures don't fit
+// the inline storage are moved to the heap
+template <typename Fn>
+void ECSCmdBuffer::pushCommand(Fn&& command_fn)
+{
+    using FnType = std::decay_t<Fn>;
+
+    if constexpr (CommandFn::fits<FnType>) {
+        m_commands.emplace_back(std::forward<Fn>(command_fn));
+    } else {
+        auto command_p = std::make_shared<FnType>(
+            std::forward<Fn>(command_fn)
+        );
+
+        m_commands.emplace_back(
+            [command_p](World* world) {
+                (*command_p)(world);
+            }
+        );
+    }
+}
+
 // Add a component to the buffer using the component constructor
 template <typename CompType, typename... Args>
 void ECSCmdBuffer::attachComponent(
     Entity entity, Args... args
 ) {
-    m_commands.emplace_back(
+    pushCommand(
         [=](World* world) {
             world->attachComponent<CompType>(entity, args...);
         }
@@ -73,7 +110,7 @@ void ECSCmdBuffer::attachComponent(
     Entity entity,
     CompType &component
 ) {
-    m_commands.emplace_back(
+    pushCommand(
         [=](World* world) {
             world->attachComponent<CompType>(entity, component);
         }
@@ -84,7 +121,7 @@ void ECSCmdBuffer::attachComponent(
 template <typename CompType>
 void ECSCmdBuffer::detachComponent(Entity entity) 
 {
-    m_commands.emplace_back(
+    pushCommand(
         [=](World* world) {
             world->detachComponent<CompType>(entity);
         }
@@ -12,9 +12,14 @@ class EntityRegister;
 
 } // namespace cndt::internal
 
+class EntityRange;
+class EntityRemap;
+
 // ECS entity type definition 
 class Entity {
     friend class internal::EntityRegister;
+    friend class EntityRange;
+    friend class EntityRemap;
 
 public:
     using EntityId = u64;
@@ -0,0 +1,39 @@
+#ifndef CNDT_ECS_ENTITY_RANGE_H
+#define CNDT_ECS_ENTITY_RANGE_H
+
+#include "conduit/defines.h"
+#include "conduit/ecs/entity.h"
+
+namespace cndt {
+
+// Contiguous range of entities ids
+class EntityRange {
+public:
+    // Create an empty range
+    EntityRange() : m_first(0), m_count(0) { }
+
+    EntityRange(Entity::EntityId first, usize count) : 
+        m_first(first),
+        m_count(count)
+    { }
+
+    // Return the entity at the given index of the range
+    Entity operator[](usize index) const { return Entity(m_first + index); }
+
+    // Return the first id of the range
+    Entity::EntityId firstId() const { return m_first; }
+
+    // Return the number of entities in the range
+    usize size() const { return m_count; }
+
+    // Return true if the range doesn't contain any entity
+    bool empty() const { return m_count == 0; }
+
+private:
+    Entity::EntityId m_first;
+    usize m_count;
+};
+
+} // namespace cndt
+
+#endif
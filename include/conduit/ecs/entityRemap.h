@@ -0,0 +1,45 @@
+#ifndef CNDT_ECS_ENTITY_REMAP_H
+#define CNDT_ECS_ENTITY_REMAP_H
+
+#include "conduit/defines.h"
+#include "conduit/ecs/entity.h"
+
+namespace cndt {
+
+// Map the entities of a merged world to the entities of the 
+// destination world, the merged world ids are moved to a
+// contiguous range so the mapping is a constant offset
+class EntityRemap {
+public:
+    // Create an empty remap, every entity is mapped to an invalid entity
+    EntityRemap() : m_offset(0), m_count(0) { }
+    
+    EntityRemap(Entity::EntityId offset, usize count) : 
+        m_offset(offset),
+        m_count(count)
+    { }
+
+    // Return the destination world entity corresponding to the given 
+    // source world entity, or an invalid entity if it is out of range
+    Entity remap(Entity entity) const 
+    {
+        if (entity.invalid() || entity.id() >= m_count)
+            return Entity();
+
+        return Entity(entity.id() + m_offset);
+    }
+
+    // Return the first id of the range assigned to the merged entities
+    Entity::EntityId offset() const { return m_offset; }
+
+    // Return the size of the range assigned to the merged entities
+    usize count() const { return m_count; }
+
+private:
+    Entity::EntityId m_offset;
+    usize m_count;
+};
+
+} // namespace cndt
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef CNDT_ECS_PREFAB_H
+#define CNDT_ECS_PREFAB_H
+
+#include "conduit/defines.h"
+
+#include "conduit/internal/ecs/ComponentTypeRegister.h"
+#include "conduit/internal/ecs/prefabComponent.h"
+
+#include <map>
+#include <memory>
+
+namespace cndt {
+
+class World;
+
+// Store a set of pre-built components to be instantiated 
+// many times in a world, at most one component per type 
+class Prefab {
+    friend class World;
+
+public:
+    // Add a component to the prefab using the component constructor,
+    // replace the component if the type is already in the prefab
+    template <typename CompType, typename... Args>
+    void addComponent(Args... args);
+
+    // Copy the given component to the prefab,
+    // replace the component if the type is already in the prefab
+    template <typename CompType>
+    void addComponent(const CompType& component);
+
+    // Remove a component type from the prefab
+    template <typename CompType>
+    void removeComponent();
+
+    // Return the number of component types in the prefab
+    usize size() const { return m_components.size(); }
+
+private:
+    using TypeId = internal::ComponentTypeRegister::TypeId;
+    using PrefabComponentPtr = 
+        std::shared_ptr<const internal::PrefabComponentBase>;
+    
+    // Store the prefab components, copied prefabs share them
+    std::map<TypeId, PrefabComponentPtr> m_components;
+};
+
+// Add a component to the prefab using the component constructor
+template <typename CompType, typename... Args>
+void Prefab::addComponent(Args... args)
+{
+    addComponent<CompType>(CompType(args...));
+}
+
+// Copy the given component to the prefab
+template <typename CompType>
+void Prefab::addComponent(const CompType& component)
+{
+    auto type_id = internal::ComponentTypeRegister::getTypeId<CompType>();
+
+    m_components[type_id] = 
+        std::make_shared<internal::PrefabComponent<CompType>>(component);
+}
+
+// Remove a component type from the prefab
+template <typename CompType>
+void Prefab::removeComponent()
+{
+    auto type_id = internal::ComponentTypeRegister::getTypeId<CompType>();
+
+    m_components.erase(type_id);
+}
+
+} // namespace cndt
+
+#endif
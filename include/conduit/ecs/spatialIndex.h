@@ -0,0 +1,142 @@
+#ifndef CNDT_ECS_SPATIAL_INDEX_H
+#define CNDT_ECS_SPATIAL_INDEX_H
+
+#include "conduit/defines.h"
+
+#include "conduit/ecs/entity.h"
+#include "conduit/ecs/world.h"
+
+#include <glm/glm.hpp>
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace cndt {
+
+// Loose uniform grid over the world entities with a Transform component.
+//
+// Every entity is stored in the cell containing its position,
+// entities with a Bounds component are treated as boxes and
+// queries are expanded by the largest half extent in the index
+class SpatialIndex {
+public:
+    // Ray cast result
+    struct RayHit {
+        Entity entity;
+
+        // Distance from the ray origin to the hit point
+        f32 distance;
+    };
+
+public:
+    // Create an empty index with the given grid cell size
+    SpatialIndex(f32 cell_size = 8.0f);
+
+    // Synchronize the index with the Transform and Bounds components,
+    // only the entities that changed cell are moved in the grid
+    void update(World& world);
+
+    // Remove all the entities from the index
+    void clear();
+
+    // Return the number of indexed entities
+    usize size() const { return m_items.size(); }
+
+    // Store in the output vector all the entities
+    // overlapping the sphere with the given center and radius
+    void queryRadius(
+        glm::vec3 center,
+        f32 radius,
+        std::vector<Entity>& out
+    ) const;
+
+    // Store in the output vector all the entities
+    // overlapping the given axis aligned box
+    void queryAabb(
+        glm::vec3 min,
+        glm::vec3 max,
+        std::vector<Entity>& out
+    ) const;
+
+    // Return the closest entity hit by the ray
+    // the direction vector doesn't need to be normalized
+    std::optional<RayHit> raycast(
+        glm::vec3 origin,
+        glm::vec3 direction,
+        f32 max_distance
+    ) const;
+
+    // Store in the output vector the k entities closest to the given point
+    // sorted by distance, the distance is measured from the entity position
+    void queryNearest(
+        glm::vec3 point,
+        usize k,
+        std::vector<Entity>& out
+    ) const;
+
+private:
+    // Packed cell coordinates
+    using CellKey = u64;
+
+    // Indexed entity data
+    struct Item {
+        Entity entity;
+
+        glm::vec3 position;
+        glm::vec3 half_extents;
+
+        // Cell containing the item and index of the item in the cell
+        CellKey cell;
+        u32 cell_slot;
+
+        // Last update the item was seen in the world
+        u64 stamp;
+    };
+
+    // Integer cell coordinate
+    struct Cell {
+        i32 x, y, z;
+    };
+
+private:
+    // Return the cell containing the given point
+    Cell cellOf(glm::vec3 point) const;
+
+    // Pack the cell coordinates in a single key
+    static CellKey cellKey(Cell cell);
+
+    // Insert or move an entity in the grid
+    void placeItem(Entity entity, glm::vec3 position);
+
+    // Remove the item at the given index from the grid and the items list
+    void removeItem(u32 item_index);
+
+    // Call the given function for every item stored in the cells range
+    template <typename Fn>
+    void forEachInCells(Cell min, Cell max, Fn fn) const;
+
+private:
+    // Grid cell size and its inverse
+    f32 m_cell_size;
+    f32 m_inv_cell_size;
+
+    // Largest half extent of the indexed entities
+    f32 m_max_half_extent;
+
+    // Current update stamp
+    u64 m_stamp;
+
+    // Indexed entities, the order is not stable
+    std::vector<Item> m_items;
+
+    // Map an entity id to its item index
+    std::vector<u32> m_entity_items;
+
+    // Map a cell to the items indices it contains
+    std::unordered_map<CellKey, std::vector<u32>> m_cells;
+};
+
+} // namespace cndt
+
+#endif
@@ -2,6 +2,10 @@
 #define CNDT_ECS_WORLD_H
 
 #include "conduit/ecs/entity.h"
+#include "conduit/ecs/entityRange.h"
+#include "conduit/ecs/entityRemap.h"
+#include "conduit/ecs/prefab.h"
+#include "conduit/ecs/worldStats.h"
 
 #include "conduit/internal/ecs/componentRegister.h"
 #include "conduit/internal/ecs/entityRegister.h"
@@ -21,6 +25,10 @@ public:
 
     // Delete an entity and it's associate components  
     void deleteEntity(Entity entity);
+
+    // Create the given number of entities with contiguous ids and 
+    // attach a copy of all the prefab components to each of them
+    EntityRange instantiate(const Prefab& prefab, usize count);
     
     // Attach component to the entity,
     // construct the component with the provided arguments.
@@ -49,7 +57,34 @@ public:
     // Execute the commands from the given commands buffer
     void executeCmdBuffer(ECSCmdBuffer& cmd_buffer);
 
+    // Move all the entities and components of the other world to this 
+    // world and return the remap from the other world entities.
+    // The other world can be built on a different thread but must not 
+    // be accessed during the merge, it is left empty afterwards.
+    // Entities stored inside components are not remapped
+    EntityRemap merge(World&& other);
+
+    // Advance the world frame counter, 
+    // called once per frame by the application main loop
+    void update();
+
+    // Return a snapshot of the world entities, 
+    // components buffers and queries statistics
+    WorldStats stats();
+
+    // Log the world statistics on the core logger
+    void logStats();
+
+    // Log the world statistics every given number of frames,
+    // a value of zero disable the periodic log
+    void setStatsLogInterval(u64 frames) { m_stats_log_interval = frames; }
+
 private:
+    // Number of update since the world creation
+    u64 m_frame_count;
+    // Number of frames between two statistics logs
+    u64 m_stats_log_interval;
+
     internal::EntityRegister m_entity_register;
     internal::ComponentRegister m_component_register;
     internal::QueryRegister m_query_register;
@@ -0,0 +1,56 @@
+#ifndef CNDT_ECS_WORLD_STATS_H
+#define CNDT_ECS_WORLD_STATS_H
+
+#include "conduit/defines.h"
+
+#include <string>
+#include <vector>
+
+namespace cndt {
+
+// Memory usage of a single component buffer
+struct ComponentBufferStats {
+    // Component type name
+    std::string type_name;
+
+    // Number of components stored in the buffer
+    usize count;
+    // Number of components the buffer can store without reallocating
+    usize capacity;
+
+    // Bytes allocated by the buffer (entity and component vectors)
+    usize bytes;
+};
+
+// Rebuild statistics of a single query storage
+struct QueryStorageStats {
+    // Query components types names
+    std::string type_name;
+
+    // Number of times the query element list was rebuilt
+    u64 rebuild_count;
+    // Duration of the last rebuild in nanoseconds
+    u64 last_rebuild_ns;
+    // Total time spent rebuilding the query in nanoseconds
+    u64 total_rebuild_ns;
+
+    // Number of elements stored in the query
+    usize element_count;
+};
+
+// Snapshot of the memory and query usage of an ECS world
+struct WorldStats {
+    // Number of alive entities
+    usize entity_count;
+    // Number of entity ids waiting in the free list
+    usize free_entity_count;
+
+    // Statistics for each component buffer in the world
+    std::vector<ComponentBufferStats> components;
+    // Statistics for each cached query in the world
+    std::vector<QueryStorageStats> queries;
+};
+
+} // namespace cndt
+
+#endif
@@ -1,14 +1,20 @@
 #ifndef CNDT_EVENT_BUS_H
 #define CNDT_EVENT_BUS_H
 
+#include "conduit/events/eventChannel.h"
 #include "conduit/events/eventReader.h"
+#include "conduit/events/eventStats.h"
 #include "conduit/events/eventWriter.h"
 
+#include "conduit/internal/core/threadPool.h"
 #include "conduit/internal/events/callbackRegister.h"
 #include "conduit/internal/events/eventRegister.h"
+#include "conduit/internal/events/eventWaitList.h"
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace cndt {
 
@@ -26,7 +32,15 @@ class EventBus {
     
     // Callback function type
     template <class EventType>
-    using CallbackFn = std::function<void(const EventType*)>;
+    using CallbackFn = EventCallbackFn<EventType>;
+
+    // Event key extractor function type
+    template <class EventType>
+    using KeyFn = EventKeyFn<EventType>;
+
+    // Event merge function type
+    template <class EventType>
+    using MergeFn = std::function<void(EventType&, const EventType&)>;
         
     // Store an id to a event type
     using EventTypeId = u64;
@@ -41,13 +55,84 @@ public:
     // Return an event writer for this bus
     EventWriter getEventWriter();
 
+    // Return the number of updates since the bus creation,
+    // used to schedule events at a given update
+    u64 updateCount() const { return m_update_count; }
+
+    // Return a snapshot of the event buffers throughput
+    // and the callbacks execution time statistics
+    EventBusStats stats();
+
+    // Log the event bus statistics on the core logger
+    void logStats();
+
+    // Log the event bus statistics every given number of updates,
+    // a value of zero disable the periodic log
+    void setStatsLogInterval(u64 updates) { m_stats_log_interval = updates; }
+
+    // Return an event writer for a single event type,
+    // the writer skip the event register lookup on every send
+    template<class EventType>
+    TypedEventWriter<EventType> getTypedEventWriter();
+
     // Return an event reader for this bus
     template<class EventType>
     EventReader<EventType> getEventReader();
 
-    // Add callbacks to the bus
+    // Return an awaitable suspending the coroutine until the next event
+    // of the given type, the coroutine is resumed during the bus update
+    // before the callbacks and must not be awaited from other threads
+    template<class EventType>
+    EventAwaiter<EventType> next();
+
+    // Add callbacks to the bus, thread safe callbacks can be executed 
+    // on the bus thread pool concurrently with other callbacks
+    template<class EventType>
+    void addCallback(
+        CallbackFn<EventType> callback_fn,
+        CallbackMode mode = CallbackMode::Serial
+    );
+
+    // Set the function extracting the dispatch key from the given 
+    // event type, must be called before adding keyed callbacks
+    template<class EventType>
+    void setEventKey(KeyFn<EventType> key_fn);
+
+    // Add a callback called only for the events whose key is equal 
+    // to the given key, keyed callbacks are looked up in a hash table
+    // and run serially after the not keyed callbacks of the same type
+    template<class EventType>
+    void addKeyedCallback(u64 key, CallbackFn<EventType> callback_fn);
+
+    // Set the thread pool used to run the thread safe callbacks,
+    // the pool must outlive the bus, null run all the callbacks serially
+    void setThreadPool(ThreadPool* thread_pool_p) 
+    { 
+        m_thread_pool_p = thread_pool_p; 
+    }
+
+    // Set how the events of the given type sent in the same update are 
+    // coalesced, the merge function is required by the merge policy
+    template<class EventType>
+    void setEventCoalescing(
+        EventCoalesce policy, 
+        MergeFn<EventType> merge_fn = nullptr
+    );
+
+    // Create a bounded event channel for the given type, the channel 
+    // is independent from the event type buffer used by the event writers
+    template<class EventType>
+    void createEventChannel(EventChannelConfig config);
+
+    // Return a writer for the given type event channel,
+    // create the channel with the default configuration if needed
+    template<class EventType>
+    ChannelWriter<EventType> getChannelWriter();
+
+    // Return a reader for the given type event channel,
+    // create the channel with the default configuration if needed
     template<class EventType>
-    void addCallback(CallbackFn<EventType> callback_fn);
+    ChannelReader<EventType> getChannelReader();
 
 private:
     // Store event buffers
@@ -55,6 +140,22 @@ private:
 
     // Store the event callbacks
     internal::CallbackRegister m_callback_register;
+
+    // Thread pool used to run the thread safe callbacks
+    ThreadPool* m_thread_pool_p;
+
+    // Number of update since the bus creation
+    u64 m_update_count;
+    // Number of updates between two statistics logs
+    u64 m_stats_log_interval;
+
+    // Coroutines waiting for an event, indexed by the event type id
+    std::mutex m_wait_mutex;
+    std::vector<std::unique_ptr<internal::EventWaitListBase>> m_wait_lists;
+
+private:
+    // Resume the coroutines waiting for the current events
+    void resumeWaiters();
 };
 
 /*
@@ -63,6 +164,14 @@ private:
  *
  * */
 
+// Return an event writer for a single event type
+template<class EventType>
+TypedEventWriter<EventType> EventBus::getTypedEventWriter() {
+    return TypedEventWriter<EventType>( 
+        m_event_register->getEventBuffer<EventType>().lock() 
+    );
+}
+
 // Return an event reader for this bus
 template<class EventType>
 EventReader<EventType> EventBus::getEventReader() {
@@ -74,10 +183,94 @@ EventReader<EventType> EventBus::getEventReader() {
 // Add callbacks to the bus
 template<class EventType>
 void EventBus::addCallback(
+    EventBus::CallbackFn<EventType> callback_fn,
+    CallbackMode mode
+) {
+    auto event_buffer_p = m_event_register->getEventBuffer<EventType>();
+    m_callback_register.addCallback<EventType>(
+        event_buffer_p, 
+        callback_fn, 
+        mode
+    );
+}
+
+// Return an awaitable suspending the coroutine until the next event
+template<class EventType>
+EventAwaiter<EventType> EventBus::next() {
+    auto type_id = internal::EventTypeRegister::getTypeId<EventType>();
+    
+    std::lock_guard<std::mutex> lock(m_wait_mutex);
+    
+    if (m_wait_lists.size() <= type_id)
+        m_wait_lists.resize(type_id + 1);
+
+    // Create the type wait list if it doesn't already exist
+    auto& wait_list_p = m_wait_lists[type_id];
+    if (wait_list_p == nullptr) {
+        wait_list_p = std::make_unique<internal::EventWaitList<EventType>>(
+            m_event_register->getEventBuffer<EventType>()
+        );
+    }
+
+    return EventAwaiter<EventType>(
+        static_cast<internal::EventWaitList<EventType>*>(wait_list_p.get())
+    );
+}
+
+// Set the function extracting the dispatch key from the given event type
+template<class EventType>
+void EventBus::setEventKey(EventBus::KeyFn<EventType> key_fn) {
+    auto event_buffer_p = m_event_register->getEventBuffer<EventType>();
+    m_callback_register.setEventKey<EventType>(event_buffer_p, key_fn);
+}
+
+// Add a callback called only for the events with the given key
+template<class EventType>
+void EventBus::addKeyedCallback(
+    u64 key, 
     EventBus::CallbackFn<EventType> callback_fn
 ) {
     auto event_buffer_p = m_event_register->getEventBuffer<EventType>();
-    m_callback_register.addCallback<EventType>(event_buffer_p, callback_fn);
+    m_callback_register.addKeyedCallback<EventType>(
+        event_buffer_p, 
+        key, 
+        callback_fn
+    );
+}
+
+// Set how the events of the given type sent in the same update are coalesced
+template<class EventType>
+void EventBus::setEventCoalescing(
+    EventCoalesce policy, 
+    EventBus::MergeFn<EventType> merge_fn
+) {
+    auto event_buffer_p = m_event_register->getEventBuffer<EventType>();
+    
+    if (auto event_buffer = event_buffer_p.lock()) {
+        event_buffer->setCoalescing(policy, merge_fn);
+    }
+}
+
+// Create a bounded event channel for the given type
+template<class EventType>
+void EventBus::createEventChannel(EventChannelConfig config) {
+    m_event_register->createEventChannel<EventType>(config);
+}
+
+// Return a writer for the given type event channel
+template<class EventType>
+ChannelWriter<EventType> EventBus::getChannelWriter() {
+    return ChannelWriter<EventType>(
+        m_event_register->getEventChannel<EventType>()
+    );
+}
+
+// Return a reader for the given type event channel
+template<class EventType>
+ChannelReader<EventType> EventBus::getChannelReader() {
+    return ChannelReader<EventType>(
+        m_event_register->getEventChannel<EventType>()
+    );
 }
 
 } // namespace cndt
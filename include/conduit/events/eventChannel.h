@@ -0,0 +1,74 @@
+#ifndef CNDT_EVENT_CHANNEL_ACCESS_H
+#define CNDT_EVENT_CHANNEL_ACCESS_H
+
+#include "conduit/defines.h"
+
+#include "conduit/internal/events/eventChannel.h"
+
+#include <memory>
+#include <optional>
+
+namespace cndt {
+
+/*
+ *
+ *      Event channel writer and reader declaration
+ *
+ * */
+
+// Write events to a bounded event channel
+template<class EventType>
+class ChannelWriter {
+    // Private event channel type definition for readability
+    using EventChannelPtr = std::shared_ptr<internal::EventChannel<EventType>>;
+
+public:
+    ChannelWriter(EventChannelPtr channel) 
+        : m_channel_p(std::move(channel)) 
+    { };
+    
+    // Send an event to the channel applying the channel overflow policy,
+    // return false if the event was discarded
+    bool send(const EventType& event) { return m_channel_p->send(event); }
+
+    // Return the number of events discarded by the channel overflow policy
+    u64 droppedCount() { return m_channel_p->droppedCount(); }
+
+private:
+    EventChannelPtr m_channel_p;
+};
+
+// Read events from a bounded event channel,
+// this reader should not be shared between threads 
+template<class EventType>
+class ChannelReader {
+    // Private event channel type definition for readability
+    using EventChannelPtr = std::shared_ptr<internal::EventChannel<EventType>>;
+
+public:
+    ChannelReader(EventChannelPtr channel) 
+        : m_channel_p(std::move(channel)), m_next_sequence(0) 
+    { };
+
+    // Call the given function for all the not read events starting 
+    // from the oldest, the channel is locked while the function runs
+    // so the function must not send events to the same channel
+    template <typename Fn>
+    void readAll(Fn fn) 
+    { 
+        m_next_sequence = m_channel_p->read(m_next_sequence, fn); 
+    }
+    
+    // Return the number of not read events
+    usize availableEvent() { return m_channel_p->available(m_next_sequence); }
+
+private:
+    EventChannelPtr m_channel_p;
+
+    // Sequence number of the next event to read
+    u64 m_next_sequence;
+};
+
+} // namespace cndt
+
+#endif
@@ -8,6 +8,8 @@
 
 #include <memory>
 #include <optional>
+#include <shared_mutex>
+#include <span>
 
 namespace cndt {
 
@@ -21,6 +23,60 @@ namespace cndt {
 template <typename EventType>
 class EventIterator;
 
+// Contiguous views over a group of events read at once, the event 
+// buffer stays locked while the batch is alive so events of the same 
+// type can't be sent from the same thread until the batch is destroyed
+template <typename EventType>
+class EventBatch 
+{
+public:
+    // Create an empty batch
+    EventBatch() = default;
+    
+    EventBatch(
+        std::shared_ptr<internal::EventBuffer<EventType>> buffer,
+        std::shared_lock<std::shared_mutex> lock,
+        std::span<const EventType> old_events,
+        std::span<const EventType> current_events
+    ) : 
+        m_buffer_p(std::move(buffer)),
+        m_lock(std::move(lock)),
+        m_old_events(old_events),
+        m_current_events(current_events)
+    { }
+
+    // Return the events sent during the previous update
+    std::span<const EventType> oldEvents() const { return m_old_events; }
+    
+    // Return the events sent during the current update
+    std::span<const EventType> currentEvents() const 
+    { 
+        return m_current_events; 
+    }
+
+    // Return the total number of events in the batch
+    usize size() const { return m_old_events.size() + m_current_events.size(); }
+    
+    // Return true if the batch doesn't contain any event
+    bool empty() const { return size() == 0; }
+
+    // Call the given function for all the events starting from the oldest
+    template <typename Fn>
+    void forEach(Fn fn) const
+    {
+        for (const EventType& event : m_old_events) { fn(event); }
+        for (const EventType& event : m_current_events) { fn(event); }
+    }
+
+private:
+    // Keep the event buffer alive while it's locked
+    std::shared_ptr<internal::EventBuffer<EventType>> m_buffer_p;
+    std::shared_lock<std::shared_mutex> m_lock;
+
+    std::span<const EventType> m_old_events;
+    std::span<const EventType> m_current_events;
+};
+
 // Read component from the event bus that generated it
 // this event reader should not be shared between threads 
 template<typename EventType>
@@ -47,6 +103,10 @@ public:
     
     // Return the number of not read events
     std::optional<usize> availableEvent();
+
+    // Consume all the not read events and return them as two 
+    // contiguous spans, the event buffer is locked only once
+    EventBatch<EventType> readAll();
     
 private:
     // Return the next event on the bus with the same type of the event reader 
@@ -163,18 +223,20 @@ template<typename EventType>
 const EventType* EventReader<EventType>::nextEvent() 
 {
     if (auto buffer_p = m_buffer_p.lock()) {
+        auto snapshot = buffer_p->snapshot();
+
         // Update the buffer index
-        updateIndex(buffer_p->m_update_count);
+        updateIndex(snapshot.update_count);
         
-        auto new_buffer = buffer_p->getCurrentEvents(); 
-        auto old_buffer = buffer_p->getOldEvents(); 
+        auto& new_buffer = *snapshot.current_events_p; 
+        auto& old_buffer = *snapshot.old_events_p; 
         
         // Get events starting from the oldest
-        if (old_buffer->size() > m_old_buffer_index) {
+        if (old_buffer.size() > m_old_buffer_index) {
             m_old_buffer_index += 1;
             return &old_buffer[m_old_buffer_index - 1];
             
-        } else if (new_buffer->size() > m_current_buffer_index) {
+        } else if (new_buffer.size() > m_current_buffer_index) {
             m_current_buffer_index += 1;
             return &new_buffer[m_current_buffer_index - 1];
         }
@@ -192,15 +254,16 @@ const EventType* EventReader<EventType>::nextEvent()
 template <typename EventType>
 std::optional<usize> EventReader<EventType>::availableEvent() {
     if (auto buffer_p = m_buffer_p.lock()) {
+        auto snapshot = buffer_p->snapshot();
+
         // Update the buffer index
-        updateIndex(buffer_p->m_update_count);
+        updateIndex(snapshot.update_count);
         
         // Calculate the events count for each buffer and add them together
-        auto new_buffer = buffer_p->getCurrentEvents(); 
-        auto old_buffer = buffer_p->getOldEvents(); 
-        
-        u64 old_count = old_buffer->size() - m_old_buffer_index;
-        u64 new_count = new_buffer->size() - m_current_buffer_index;
+        u64 old_count = 
+            snapshot.old_events_p->size() - m_old_buffer_index;
+        u64 new_count = 
+            snapshot.current_events_p->size() - m_current_buffer_index;
 
         return old_count + new_count;
     } else {
@@ -212,6 +275,40 @@ std::optional<usize> EventReader<EventType>::availableEvent() {
         
     return std::nullopt;
 }
+
+// Consume all the not read events and return them as two contiguous spans
+template <typename EventType>
+EventBatch<EventType> EventReader<EventType>::readAll() {
+    if (auto buffer_p = m_buffer_p.lock()) {
+        auto snapshot = buffer_p->snapshot();
+
+        // Update the buffer index
+        updateIndex(snapshot.update_count);
+
+        std::span<const EventType> old_events(*snapshot.old_events_p);
+        std::span<const EventType> new_events(*snapshot.current_events_p);
+
+        old_events = old_events.subspan(m_old_buffer_index);
+        new_events = new_events.subspan(m_current_buffer_index);
+
+        m_old_buffer_index = snapshot.old_events_p->size();
+        m_current_buffer_index = snapshot.current_events_p->size();
+
+        return EventBatch<EventType>(
+            std::move(buffer_p),
+            std::move(snapshot.lock), 
+            old_events, 
+            new_events
+        );
+    } else {
+        log::core::error(
+            "EventReader::readAll -> buffer was deleted; Type: {}",
+            typeid(EventType).name()
+        );
+    }
+
+    return EventBatch<EventType>();
+}
     
 } // namespace cndt
 
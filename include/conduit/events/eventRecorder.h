@@ -0,0 +1,278 @@
+#ifndef CNDT_EVENT_RECORDER_H
+#define CNDT_EVENT_RECORDER_H
+
+#include "conduit/defines.h"
+#include "conduit/logging.h"
+#include "conduit/time.h"
+
+#include "conduit/events/eventBus.h"
+#include "conduit/events/eventWriter.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace cndt::eventtag {
+
+// Stable event type tags stored in the event logs,
+// the values must never change between engine versions
+
+constexpr u32 KEY_PRESS             = 1;
+constexpr u32 KEY_REPEAT            = 2;
+constexpr u32 KEY_RELEASE           = 3;
+
+constexpr u32 MOUSE_KEY_PRESS       = 16;
+constexpr u32 MOUSE_KEY_RELEASE     = 17;
+constexpr u32 MOUSE_SCROLL          = 18;
+constexpr u32 MOUSE_POSITION        = 19;
+
+constexpr u32 WINDOW_CLOSE          = 32;
+constexpr u32 WINDOW_FOCUS_GAIN     = 33;
+constexpr u32 WINDOW_FOCUS_LOST     = 34;
+constexpr u32 WINDOW_RESIZE         = 35;
+constexpr u32 WINDOW_MOVE           = 36;
+
+// First tag available for the user event types
+constexpr u32 USER                  = 1024;
+
+} // namespace cndt::eventtag
+
+namespace cndt {
+
+/*
+ *
+ *      Event serializer
+ *
+ * */
+
+// Convert an event to and from its binary log representation,
+// the default serializer copy the event memory so it's only
+// available for trivially copyable types, other event types
+// opt in to the recording by specializing the serializer
+template <class EventType>
+struct EventSerializer {
+    static_assert(
+        std::is_trivially_copyable_v<EventType>,
+        "Event type not trivially copyable, specialize cndt::EventSerializer"
+    );
+
+    // Append the event bytes to the output buffer
+    static void write(const EventType& event, std::vector<u8>& out)
+    {
+        usize offset = out.size();
+
+        out.resize(offset + sizeof(EventType));
+        std::memcpy(out.data() + offset, &event, sizeof(EventType));
+    }
+
+    // Read an event from its bytes, return nullopt if the data is invalid
+    static std::optional<EventType> read(std::span<const u8> data)
+    {
+        if (data.size() != sizeof(EventType))
+            return std::nullopt;
+
+        EventType event;
+        std::memcpy(&event, data.data(), sizeof(EventType));
+
+        return event;
+    }
+};
+
+/*
+ *
+ *      Event recorder definition
+ *
+ * */
+
+// Record the events sent to an event bus in a binary log file.
+//
+// Every record stores the frame number, the time since the recording
+// started, the event type tag and the serialized event. The recorded
+// events are captured by callbacks, so the log contains the events
+// as they are seen by the callbacks after coalescing
+class EventRecorder {
+public:
+    EventRecorder(EventBus& event_bus);
+    ~EventRecorder();
+
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+
+    // Create the log file and start recording, return false on failure
+    bool start(const std::filesystem::path& path);
+
+    // Write the pending records and close the log file
+    void stop();
+
+    // Return true if the recorder is writing to a log file
+    bool isRecording() const;
+
+    // Record the events of the given type with the given stable tag
+    template <class EventType>
+    void recordType(u32 tag);
+
+    // Record all the engine window, keyboard and mouse events
+    void recordEngineEvents();
+
+    // Write the records of the current frame and advance the frame,
+    // must be called once per frame after the event bus update
+    void update();
+
+private:
+    // Recording state shared with the event callbacks,
+    // the callbacks can't be removed and may outlive the recorder
+    struct State {
+        std::ofstream file;
+        bool recording = false;
+
+        // Current frame and recording start time
+        u64 frame = 0;
+        time::StopWatch clock;
+
+        // Serialized records not yet written to the file
+        std::vector<u8> records;
+
+        // Write a record header and return the record size offset
+        usize beginRecord(u32 tag);
+
+        // Write the event size in the record header
+        void endRecord(usize size_offset);
+    };
+
+private:
+    // Register the tag, return false if it's already in use
+    bool addTag(u32 tag);
+
+private:
+    EventBus& m_event_bus;
+
+    std::shared_ptr<State> m_state_p;
+
+    // Tags of the recorded event types
+    std::unordered_set<u32> m_tags;
+};
+
+/*
+ *
+ *      Event player definition
+ *
+ * */
+
+// Replay an event log through an event writer, the events are sent
+// in the same frame they were recorded, timestamps are ignored so
+// the replay is deterministic regardless of the frame rate
+class EventPlayer {
+public:
+    EventPlayer(EventWriter event_writer);
+
+    // Load the log file, return false if it's missing or invalid
+    bool open(const std::filesystem::path& path);
+
+    // Replay the events with the given stable tag as the given type
+    template <class EventType>
+    void registerType(u32 tag);
+
+    // Replay all the engine window, keyboard and mouse events
+    void registerEngineEvents();
+
+    // Send the events recorded in the current frame and advance the frame,
+    // must be called once per frame before the event bus update
+    void update();
+
+    // Return true if all the recorded events were sent
+    bool finished() const { return m_offset >= m_data.size(); }
+
+    // Return the current replay frame
+    u64 frame() const { return m_frame; }
+
+private:
+    // Function deserializing an event and sending it
+    using ReplayFn = std::function<void(std::span<const u8>, EventWriter&)>;
+
+private:
+    EventWriter m_event_writer;
+
+    // Map the event tags to the replay functions
+    std::unordered_map<u32, ReplayFn> m_replay_fns;
+
+    // Tags found in the log without a registered type
+    std::unordered_set<u32> m_unknown_tags;
+
+    // Log content and read offset
+    std::vector<u8> m_data;
+    usize m_offset;
+
+    u64 m_frame;
+};
+
+/*
+ *
+ *      Event recorder template implementation
+ *
+ * */
+
+// Record the events of the given type with the given stable tag
+template <class EventType>
+void EventRecorder::recordType(u32 tag)
+{
+    if (!addTag(tag))
+        return;
+
+    m_event_bus.addCallback<EventType>(
+        [state_p = m_state_p, tag](const EventType* event) {
+            if (!state_p->recording)
+                return;
+
+            usize size_offset = state_p->beginRecord(tag);
+            EventSerializer<EventType>::write(*event, state_p->records);
+            state_p->endRecord(size_offset);
+        }
+    );
+}
+
+/*
+ *
+ *      Event player template implementation
+ *
+ * */
+
+// Replay the events with the given stable tag as the given type
+template <class EventType>
+void EventPlayer::registerType(u32 tag)
+{
+    if (m_replay_fns.contains(tag)) {
+        log::core::warn(
+            "EventPlayer::registerType -> tag {} already registered; Type: {}",
+            tag,
+            typeid(EventType).name()
+        );
+
+        return;
+    }
+
+    m_replay_fns[tag] = [tag](std::span<const u8> data, EventWriter& writer) {
+        auto event = EventSerializer<EventType>::read(data);
+
+        if (!event.has_value()) {
+            log::core::warn(
+                "EventPlayer::update -> invalid event data; Tag: {}", tag
+            );
+
+            return;
+        }
+
+        writer.send<EventType>(*event);
+    };
+}
+
+} // namespace cndt
+
+#endif
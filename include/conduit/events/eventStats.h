@@ -0,0 +1,65 @@
+#ifndef CNDT_EVENT_STATS_H
+#define CNDT_EVENT_STATS_H
+
+#include "conduit/defines.h"
+
+#include <string>
+#include <vector>
+
+namespace cndt {
+
+// Throughput and memory usage of a single event buffer
+struct EventBufferStats {
+    // Event type name
+    std::string type_name;
+
+    // Number of events sent during the last completed update
+    u64 last_update_events;
+    // Number of events sent since the buffer creation
+    u64 total_events;
+    // Largest number of events sent during a single update
+    u64 high_water_mark;
+
+    // Number of events the buffers can store without reallocating
+    usize capacity;
+    // Bytes allocated by the odd and even event vectors
+    usize bytes;
+};
+
+// Execution time of a single event callback
+struct CallbackStats {
+    // Event type name
+    std::string type_name;
+
+    // Index of the callback in the event type callbacks,
+    // the keyed callbacks of a type share a single entry
+    usize callback_index;
+
+    // True if the callback can run on the thread pool
+    bool thread_safe;
+    // True if the entry measure the keyed callbacks dispatch
+    bool keyed;
+
+    // Number of events processed by the callback
+    u64 event_count;
+    // Total time spent in the callback in nanoseconds
+    u64 total_ns;
+    // Longest single dispatch in nanoseconds, a dispatch is
+    // an update for the serial callbacks and a job for the others
+    u64 max_ns;
+};
+
+// Snapshot of the event bus buffers and callbacks usage
+struct EventBusStats {
+    // Number of bus updates since the bus creation
+    u64 update_count;
+
+    // Statistics for each event buffer in the bus
+    std::vector<EventBufferStats> buffers;
+    // Statistics for each callback in the bus
+    std::vector<CallbackStats> callbacks;
+};
+
+} // namespace cndt
+
+#endif
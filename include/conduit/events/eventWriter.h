@@ -6,6 +6,7 @@
 #include "conduit/internal/events/eventRegister.h"
 
 #include <memory>
+#include <span>
 
 namespace cndt {
 
@@ -15,6 +16,34 @@ namespace cndt {
  *
  * */
 
+// Write events of a single type to the event bus that generated it,
+// the event buffer is cached so sending an event cost only the append.
+// The writer keeps the event buffer alive after the bus is deleted
+template<class EventType>
+class TypedEventWriter {
+    // Private event buffer type definition for readability
+    using EventBufferPtr = std::shared_ptr<internal::EventBuffer<EventType>>;
+    
+public:   
+    TypedEventWriter(EventBufferPtr event_buffer) 
+        : m_event_buffer_p(std::move(event_buffer)) 
+    { };
+
+    // Send an event to the event bus that generated the writer
+    void send(const EventType& event);
+
+    // Send all the given events locking the event buffer only once
+    void sendBatch(std::span<const EventType> events);
+
+    // Send an event without locking the event buffer, the event is 
+    // published at the next bus update before running the callbacks
+    void sendConcurrent(const EventType& event);
+
+private:
+    // Event buffer of the writer event type
+    EventBufferPtr m_event_buffer_p;
+};
+
 // Write event to the event bus that generated it 
 // this event writer should not be shared between threads 
 class EventWriter {
@@ -27,11 +56,71 @@ public:
     template<class EventType>
     void send(const EventType& event);
 
+    // Send all the given events locking the event buffer only once
+    template<class EventType>
+    void sendBatch(std::span<const EventType> events);
+
+    // Send an event without locking the event buffer, the event is 
+    // published at the next bus update before running the callbacks.
+    // Used by threads sending many events every frame
+    template<class EventType>
+    void sendConcurrent(const EventType& event);
+
+    // Send an event after the given delay in seconds, the delay is 
+    // measured with the engine clock and checked at every bus update.
+    // The returned handle can cancel the event before it's sent
+    template<class EventType>
+    TimerHandle sendDelayed(const EventType& event, f64 delay);
+
+    // Send an event during the bus update with the given update count, 
+    // an already reached update count send it at the next update
+    template<class EventType>
+    TimerHandle sendAt(const EventType& event, u64 update_count);
+
+    // Return a typed event writer caching the event type buffer
+    template<class EventType>
+    TypedEventWriter<EventType> getTypedWriter();
+
 private:
     // Reference to the event register that generated the event writer
     std::weak_ptr<internal::EventRegister> m_event_register;
 };
 
+/*
+ *
+ *      Typed event writer template implementation
+ *
+ * */
+
+template<class EventType>
+void TypedEventWriter<EventType>::send(const EventType& event) {
+    if (m_event_buffer_p) {
+        m_event_buffer_p->append(event);
+    } else {
+        log::core::error("TypedEventWriter::send -> event buffer is null");
+    }
+}
+
+template<class EventType>
+void TypedEventWriter<EventType>::sendBatch(std::span<const EventType> events) {
+    if (m_event_buffer_p) {
+        m_event_buffer_p->appendBatch(events);
+    } else {
+        log::core::error("TypedEventWriter::sendBatch -> event buffer is null");
+    }
+}
+
+template<class EventType>
+void TypedEventWriter<EventType>::sendConcurrent(const EventType& event) {
+    if (m_event_buffer_p) {
+        m_event_buffer_p->appendConcurrent(event);
+    } else {
+        log::core::error(
+            "TypedEventWriter::sendConcurrent -> event buffer is null"
+        );
+    }
+}
+
 /*
  *
  *      Event writer template implementation
@@ -54,6 +143,80 @@ void EventWriter::send(const EventType& event) {
     }
 }
 
+template<class EventType>
+void EventWriter::sendBatch(std::span<const EventType> events) {
+    // Get a reference to the type event buffers
+    if (auto event_register = m_event_register.lock()) {
+        auto event_buffer = event_register->getEventBuffer<EventType>(); 
+        
+        // Add all the events to the end of the buffer
+        event_buffer.lock()->appendBatch(events);
+        
+    } else {
+        // If the event register was deleted log a error message
+        log::core::error(
+            "EventWriter::sendBatch -> event register was deleted"
+        );
+    }
+}
+
+template<class EventType>
+void EventWriter::sendConcurrent(const EventType& event) {
+    // Get a reference to the type event buffers
+    if (auto event_register = m_event_register.lock()) {
+        auto event_buffer = event_register->getEventBuffer<EventType>(); 
+        
+        // Stage the event in the buffer lock free queue
+        event_buffer.lock()->appendConcurrent(event);
+        
+    } else {
+        // If the event register was deleted log a error message
+        log::core::error(
+            "EventWriter::sendConcurrent -> event register was deleted"
+        );
+    }
+}
+
+template<class EventType>
+TimerHandle EventWriter::sendDelayed(const EventType& event, f64 delay) {
+    if (auto event_register = m_event_register.lock()) {
+        return event_register->scheduleDelayed(event, delay);
+    } else {
+        log::core::error(
+            "EventWriter::sendDelayed -> event register was deleted"
+        );
+    }
+
+    return TimerHandle();
+}
+
+template<class EventType>
+TimerHandle EventWriter::sendAt(const EventType& event, u64 update_count) {
+    if (auto event_register = m_event_register.lock()) {
+        return event_register->scheduleAt(event, update_count);
+    } else {
+        log::core::error("EventWriter::sendAt -> event register was deleted");
+    }
+
+    return TimerHandle();
+}
+
+// Return a typed event writer caching the event type buffer
+template<class EventType>
+TypedEventWriter<EventType> EventWriter::getTypedWriter() {
+    if (auto event_register = m_event_register.lock()) {
+        return TypedEventWriter<EventType>(
+            event_register->getEventBuffer<EventType>().lock()
+        );
+    } else {
+        log::core::error(
+            "EventWriter::getTypedWriter -> event register was deleted"
+        );
+    }
+
+    return TypedEventWriter<EventType>(nullptr);
+}
+
 } // namespace cndt
 
 #endif
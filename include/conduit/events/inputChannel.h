@@ -0,0 +1,131 @@
+#ifndef CNDT_INPUT_CHANNEL_H
+#define CNDT_INPUT_CHANNEL_H
+
+#include "conduit/defines.h"
+#include "conduit/time.h"
+
+#include "conduit/events/eventWriter.h"
+#include "conduit/events/events.h"
+
+#include "conduit/internal/core/spscQueue.h"
+
+#include <atomic>
+#include <variant>
+
+namespace cndt {
+
+// Input event stored in the input channel
+using InputEvent = std::variant<
+    KeyPressEvent,
+    KeyRepeatEvent,
+    KeyReleaseEvent,
+    MouseKeyPressEvent,
+    MouseKeyReleaseEvent,
+    MouseScrollEvent,
+    MousePositionEvent
+>;
+
+// Input event with the time it was produced
+struct TimedInputEvent {
+    // Epoch time in seconds when the event was sent to the channel
+    f64 time;
+
+    InputEvent event;
+};
+
+/*
+ *
+ *      Input channel definition
+ *
+ * */
+
+// Lock free channel moving timestamped input events from the thread
+// pumping the window events to the thread updating the simulation.
+//
+// There must be a single producer and a single consumer thread,
+// the consumer drains the channel at the start of every update
+class InputChannel {
+public:
+    // Default number of input events stored between two drains
+    static constexpr usize default_capacity = 4096;
+
+public:
+    InputChannel(usize capacity = default_capacity);
+    ~InputChannel() = default;
+
+    InputChannel(const InputChannel&) = delete;
+    InputChannel& operator=(const InputChannel&) = delete;
+
+    // Timestamp and append an input event, if the channel is full the
+    // event is dropped and false is returned. Producer thread only
+    template <class EventType>
+    bool send(const EventType& event);
+
+    // Send all the stored input events to the event bus in the order
+    // they were produced, return the number of drained events.
+    // Consumer thread only
+    usize drain(EventWriter& writer);
+
+    // Call the given function with all the stored timestamped input
+    // events, return the number of drained events. Consumer thread only
+    template <typename Fn>
+    usize drain(Fn&& fn);
+
+    // Return the number of events dropped because the channel was full
+    u64 dropped() const;
+
+    // Return the maximum number of stored input events
+    usize capacity() const { return m_queue.capacity(); }
+
+private:
+    internal::SpscQueue<TimedInputEvent> m_queue;
+
+    // Number of events dropped since the channel creation
+    std::atomic<u64> m_dropped;
+    // Dropped events already reported by the consumer
+    u64 m_reported_dropped;
+
+    time::Clock m_clock;
+};
+
+/*
+ *
+ *      Input channel implementation
+ *
+ * */
+
+// Timestamp and append an input event
+template <class EventType>
+bool InputChannel::send(const EventType& event)
+{
+    TimedInputEvent timed_event = {
+        .time = m_clock.now(),
+        .event = event
+    };
+
+    if (!m_queue.push(timed_event)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    return true;
+}
+
+// Call the given function with all the stored timestamped input events
+template <typename Fn>
+usize InputChannel::drain(Fn&& fn)
+{
+    usize drained = 0;
+
+    TimedInputEvent timed_event;
+    while (m_queue.pop(timed_event)) {
+        fn(timed_event);
+        drained++;
+    }
+
+    return drained;
+}
+
+} // namespace cndt
+
+#endif
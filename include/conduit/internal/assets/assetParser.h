@@ -7,12 +7,16 @@
 #include "conduit/assets/assetsManagerException.h"
 #include "conduit/assets/assetInfo.h"
 #include "conduit/assets/assetsTypeFuns.h"
+#include "conduit/internal/core/fileWatcher.h"
 
 #include <filesystem>
 #include <fstream>
 #include <optional>
+#include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 #include <fmt/format.h>
@@ -21,6 +25,17 @@ namespace cndt::internal {
 
 using json = nlohmann::json;
 
+// Store the names of the assets of the given type,
+// used to report the entries changed by a table update
+template<typename AssetType>
+struct AssetNameSet {
+    std::unordered_set<std::string> names;
+};
+
+// Store one asset name set for each asset type
+template<typename... AssetTypes>
+using AssetNameSets = std::tuple<AssetNameSet<AssetTypes>...>;
+
 template<typename... AssetTypes>
 class AssetParser {
 private:
@@ -36,6 +51,14 @@ private:
         Table() = default;
         // Load the table from a json file
         Table(json type_table);
+
+        // Parse only the entries of the given table that differ from the 
+        // stored ones and remove the missing entries, the names of the 
+        // added, changed and removed entries are inserted in the set
+        void update(
+            json type_table, 
+            std::unordered_set<std::string>& changed_names
+        );
         
         // Get the asset info in the map
         // Return an empty option if the asset doesn't exist
@@ -48,6 +71,9 @@ private:
         
         // Store the table in memory at all times
         std::unordered_map<Key, AssetInfo<AssetType>> m_table_map;
+
+        // Store the entries json, compared on update to find the changes
+        std::unordered_map<Key, json> m_entries;
     };
     
     using Tables = std::tuple<Table<AssetTypes>...>;
@@ -67,13 +93,34 @@ public:
         std::string_view asset_name
     ) const;
 
+    // Return the paths of all the asset tables, builtin table included
+    const std::vector<std::filesystem::path>& tablePaths() const 
+    { 
+        return m_table_paths; 
+    }
+
+    // Parse the given table file again updating only the changed entries,
+    // the changed asset names are inserted in the name sets
+    //
+    // Return false if the file isn't one of the parser tables
+    bool updateTable(
+        const std::filesystem::path& table_path,
+        AssetNameSets<AssetTypes...>& changed_names
+    );
+
 private:
     // Create a tables tuple from the given file path
     Tables createTable(std::filesystem::path table_path);
 
+    // Read the json table at the given path
+    json readTable(const std::filesystem::path& table_path);
+
 private:
     // Json asset tables
     std::vector<Tables> m_tables;
+
+    // Asset tables paths, with the same index of the tables
+    std::vector<std::filesystem::path> m_table_paths;
 };
 
 /*
@@ -86,23 +133,32 @@ private:
 template<typename... AssetTypes>
 template<typename AssetType>
 AssetParser<AssetTypes...>::Table<AssetType>::Table(json type_table) {
+    std::unordered_set<std::string> changed_names;
+    update(type_table, changed_names);
+}
+
+// Parse only the entries of the given table that differ from the stored ones
+template<typename... AssetTypes>
+template<typename AssetType>
+void AssetParser<AssetTypes...>::Table<AssetType>::update(
+    json type_table,
+    std::unordered_set<std::string>& changed_names
+) {
     for (auto& element : type_table.items()) {
+        Table::Key key(element.key());
+
+        // Skip the entries that didn't change
+        auto entry_it = m_entries.find(key);
+        if (entry_it != m_entries.end() && entry_it->second == element.value())
+            continue;
+
+        m_entries[key] = element.value();
+        m_table_map.erase(key);
+        changed_names.insert(key);
+
         // Catch exception during parsing and print them to screen
-        // in case of error no asset will be added to the table
+        // in case of error the asset will not be added to the table
         try {
-            Table::Key key(element.key());
-
-            // Check for duplicate element 
-            // (Should never happen with current json lib)
-            if (m_table_map.find(key) != m_table_map.end()) {
-                log::core::error(
-                    "Duplicate asset \"{}\" in {}; {}",
-                    key,
-                    assetTableName<AssetType>(),
-                    "Using the last declared asset"
-                );
-            }
-
             // Add the entry to the table
             AssetInfo<AssetType> info = 
                 parseTableEntry<AssetType>(
@@ -127,6 +183,19 @@ AssetParser<AssetTypes...>::Table<AssetType>::Table(json type_table) {
             );
         }
     }
+
+    // Remove the entries no longer in the table
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (type_table.contains(it->first)) {
+            it++;
+            continue;
+        }
+
+        changed_names.insert(it->first);
+        m_table_map.erase(it->first);
+        
+        it = m_entries.erase(it);
+    }
 }
 
 // Get the asset info in the map
@@ -158,6 +227,7 @@ AssetParser<AssetTypes...>::Table<AssetType>::getInfo(
 template<typename... AssetTypes>
 AssetParser<AssetTypes...>::AssetParser() {
     m_tables.push_back(createTable(builtin_table_path));
+    m_table_paths.push_back(builtin_table_path);
 }
 
 // Create the asset allocator using 
@@ -167,10 +237,12 @@ AssetParser<AssetTypes...>::AssetParser(
     std::vector<std::filesystem::path> asset_table_paths
 ) {
     m_tables.push_back(createTable(builtin_table_path));
+    m_table_paths.push_back(builtin_table_path);
 
     // Add the user tables
     for (auto& path : asset_table_paths) {
-        // For user table error warn the user but catch exception
+        // For user table error warn the user but catch exception,
+        // an empty table is kept so a fixed table can be updated
         try {
             m_tables.push_back(createTable(path));
 
@@ -181,7 +253,11 @@ AssetParser<AssetTypes...>::AssetParser(
                 e.what(),
                 "All the table assets will be ingored"
             );
+
+            m_tables.push_back(Tables());
         }
+
+        m_table_paths.push_back(path);
     }
 }
 
@@ -208,11 +284,71 @@ std::optional<AssetInfo<AssetType>> AssetParser<AssetTypes...>::getInfo(
     return std::nullopt;
 }
 
+// Parse the given table file again updating only the changed entries
+template<typename... AssetTypes>
+bool AssetParser<AssetTypes...>::updateTable(
+    const std::filesystem::path& table_path,
+    AssetNameSets<AssetTypes...>& changed_names
+) {
+    std::filesystem::path normal_path = FileWatcher::normalize(table_path);
+
+    for (usize i = 0; i < m_table_paths.size(); i++) {
+        if (FileWatcher::normalize(m_table_paths[i]) != normal_path)
+            continue;
+
+        // Keep the current table if the new one can't be parsed,
+        // the file may be saved again shortly after
+        try {
+            json table = readTable(table_path);
+            
+            auto _ = {
+                (std::get<Table<AssetTypes>>(m_tables[i]).update(
+                    table.at(assetTableName<AssetTypes>()),
+                    std::get<AssetNameSet<AssetTypes>>(changed_names).names
+                ), 0)...
+            };
+            
+        } catch (std::exception &e) {
+            log::core::error(
+                "Error while updating asset table \"{}\": {} - ({})",
+                table_path.string(),
+                e.what(),
+                "The table assets will not be updated"
+            );
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
 // Create a tables tuple from the given file path
 template<typename... AssetTypes>
 typename AssetParser<AssetTypes...>::Tables
 AssetParser<AssetTypes...>::createTable(
     std::filesystem::path table_path
+) {
+    json table = readTable(table_path);
+
+    try {
+        return std::make_tuple(
+            Table<AssetTypes>(table.at(assetTableName<AssetTypes>()))...
+        );
+        
+    } catch (std::exception &e) {
+        throw AssetTableParseError(
+            "Asset table ({}) parse error: {}",
+            table_path.string(),
+            e.what()
+        );
+    }
+}
+
+// Read the json table at the given path
+template<typename... AssetTypes>
+json AssetParser<AssetTypes...>::readTable(
+    const std::filesystem::path& table_path
 ) {
     if(!std::filesystem::exists(table_path)) {
         throw AssetTableNotFound(
@@ -224,11 +360,7 @@ AssetParser<AssetTypes...>::createTable(
     try {
         // Read the json file
         std::ifstream f(table_path);
-        json table = json::parse(f);
-
-        return std::make_tuple(
-            Table<AssetTypes>(table.at(assetTableName<AssetTypes>()))...
-        );
+        return json::parse(f);
         
     } catch (std::exception &e) {
         throw AssetTableParseError(
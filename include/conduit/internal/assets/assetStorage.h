@@ -6,7 +6,9 @@
 #include "conduit/assets/assetInfo.h"
 #include "conduit/assets/assetsManagerException.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 namespace cndt::internal {
@@ -37,6 +39,14 @@ public:
         m_available(false),
         m_version(0)
     { };
+    // Create a storage for an asset still being loaded,
+    // the storage is unavailable until the asset is published
+    AssetStorage(AssetInfo<AssetType> asset_info) :
+        m_asset(nullptr),
+        m_info(asset_info),
+        m_available(false),
+        m_version(0)
+    { };
     
     // Get a constant reference to the asset
     const AssetType* asset() const { 
@@ -62,10 +72,13 @@ public:
     const AssetInfo<AssetType>& info() const { return m_info; }
 
     // Return true if the asset is available
-    bool isAvailable() const { return m_available; }
+    bool isAvailable() const 
+    { 
+        return m_available.load(std::memory_order_acquire); 
+    }
 
     // Return the current loaded asset version
-    u64 version() const { return m_version; }
+    u64 version() const { return m_version.load(std::memory_order_acquire); }
 
 private:
     // Get a reference to the asset info
@@ -77,10 +90,12 @@ private:
         AssetInfo<AssetType> asset_info,
         std::unique_ptr<AssetType> asset
     ) {
+        std::lock_guard lock(m_update_mutex);
+
         m_info = asset_info;
         m_asset = std::move(asset);
 
-        if (asset != nullptr) {
+        if (m_asset != nullptr) {
             makeAvailable();
         } else {
             makeUnavailable();
@@ -89,13 +104,41 @@ private:
         incrementVersion();
     }   
 
+    // Store an asset loaded in the background and make it available,
+    // the asset is discarded and false is returned if the storage 
+    // was updated since the load started at the given version
+    bool publishAsset(
+        u64 load_version,
+        std::unique_ptr<AssetType> asset
+    ) {
+        std::lock_guard lock(m_update_mutex);
+
+        if (version() != load_version)
+            return false;
+
+        m_asset = std::move(asset);
+        makeAvailable();
+        incrementVersion();
+
+        return true;
+    }
+
     // Increment the asset version 
-    void incrementVersion() { m_version += 1; }
+    void incrementVersion() 
+    { 
+        m_version.fetch_add(1, std::memory_order_acq_rel); 
+    }
     
     // Set the availability of the asset
-    void makeAvailable() { m_available = true; }
+    void makeAvailable() 
+    { 
+        m_available.store(true, std::memory_order_release); 
+    }
     // Set the availability of the asset
-    void makeUnavailable() { m_available = false; }
+    void makeUnavailable() 
+    { 
+        m_available.store(false, std::memory_order_release); 
+    }
     
 private:
     // Store the asset in a unique pointer
@@ -104,10 +147,13 @@ private:
     // Store the asset information
     AssetInfo<AssetType> m_info;
 
+    // Serialize the asset updates from the loader threads
+    std::mutex m_update_mutex;
+
     // The asset is loaded and available
-    bool m_available;
+    std::atomic<bool> m_available;
     // The asset version, incremented by one for each update
-    u64 m_version;
+    std::atomic<u64> m_version;
 };
 
 } // namespace cndt::internal
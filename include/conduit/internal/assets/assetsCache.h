@@ -9,11 +9,16 @@
 #include "conduit/assets/assetsTypeFuns.h"
 
 #include "conduit/internal/assets/assetStorage.h"
+#include "conduit/internal/core/fileWatcher.h"
+#include "conduit/internal/core/threadPool.h"
 
+#include <functional>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace cndt::internal {
 
@@ -39,13 +44,68 @@ public:
         std::optional<AssetInfo<AssetType>> asset_info
     );
 
-    // Take a parser and update the current cached assets
-    void updateAssets(const AssetParser<AssetTypes...>& parser);
+    // Get an asset handle without waiting for the asset loading,
+    // a not cached asset is loaded on the given thread pool and the 
+    // handle become available when the loading is complete
+    template<typename AssetType>
+    AssetHandle<AssetType> getHandleAsync(
+        std::string_view asset_name,
+        std::optional<AssetInfo<AssetType>> asset_info,
+        ThreadPool* thread_pool_p
+    );
+
+    // Take a parser and update the current cached assets,
+    // the assets are reloaded in parallel on the given thread pool
+    void updateAssets(
+        const AssetParser<AssetTypes...>& parser,
+        ThreadPool* thread_pool_p = nullptr
+    );
+
+    // Reload only the cached assets whose table entry changed or 
+    // whose source files are in the given set of normal paths
+    void updateChangedAssets(
+        const AssetParser<AssetTypes...>& parser,
+        const AssetNameSets<AssetTypes...>& changed_names,
+        const std::unordered_set<std::string>& changed_files,
+        ThreadPool* thread_pool_p = nullptr
+    );
+
+    // Call the given function with the info of every cached asset
+    template <typename Fn>
+    void forEachInfo(Fn fn);
 
 private:
-    // Update the asset cache of a given type
+    // Append the reload tasks of the given type cached assets
+    template <typename AssetType>
+    void updateAssetsCache(
+        const AssetParser<AssetTypes...>& parser,
+        std::vector<std::function<void(void)>>& reload_tasks
+    );
+
+    // Append the reload tasks of the given type changed cached assets
+    template <typename AssetType>
+    void updateChangedCache(
+        const AssetParser<AssetTypes...>& parser,
+        const AssetNameSet<AssetType>& changed_names,
+        const std::unordered_set<std::string>& changed_files,
+        std::vector<std::function<void(void)>>& reload_tasks
+    );
+
+    // Append the task reloading the given asset with the new info,
+    // the asset is made unavailable now if it's not in the tables
     template <typename AssetType>
-    void updateAssetsCache(const AssetParser<AssetTypes...>& parser);
+    static void queueReload(
+        const std::string& key,
+        std::shared_ptr<AssetStorage<AssetType>> asset,
+        std::optional<AssetInfo<AssetType>> info,
+        std::vector<std::function<void(void)>>& reload_tasks
+    );
+
+    // Run the reload tasks on the thread pool and wait for them
+    static void runReloadTasks(
+        std::vector<std::function<void(void)>>& reload_tasks,
+        ThreadPool* thread_pool_p
+    );
 
 private:
     // Store the cached asset storage
@@ -103,8 +163,12 @@ AssetHandle<AssetType> AssetsCache<AssetTypes...>::getHandle(
                     e.what()
                 );
 
+                // Keep the info so a change of the asset source files
+                // can be traced back to this storage
                 auto empty_storage =
-                    std::make_shared<AssetStorage<AssetType>>();
+                    std::make_shared<AssetStorage<AssetType>>(
+                        asset_info.value()
+                    );
 
                 // Store the empty storage in case a future asset update
                 // make the asset available
@@ -124,14 +188,126 @@ AssetHandle<AssetType> AssetsCache<AssetTypes...>::getHandle(
     }
 }
 
+// Get an asset handle without waiting for the asset loading
+template<typename... AssetTypes>
+template<typename AssetType>
+AssetHandle<AssetType> AssetsCache<AssetTypes...>::getHandleAsync(
+    std::string_view asset_name,
+    std::optional<AssetInfo<AssetType>> asset_info,
+    ThreadPool* thread_pool_p
+) {
+    // Without a thread pool or a valid info struct load synchronously
+    if (thread_pool_p == nullptr || !asset_info.has_value()) {
+        return getHandle<AssetType>(asset_name, asset_info);
+    }
+
+    Cache<AssetType>& cache = std::get<Cache<AssetType>>(m_caches);
+    std::weak_ptr<AssetStorage<AssetType>> storage_p = 
+        cache[std::string(asset_name)];
+
+    // If the asset is cached or already loading return an handle to it
+    if (!storage_p.expired()) {
+        return AssetHandle<AssetType>(storage_p.lock());
+    }
+
+    log::core::trace(
+        "Asset manager: loading asset \"{}\" asynchronously",
+        asset_name
+    );
+
+    // Store an unavailable storage in the cache, 
+    // the loader publishes the asset when done
+    auto new_storage = 
+        std::make_shared<AssetStorage<AssetType>>(asset_info.value());
+    cache[std::string(asset_name)] = new_storage;
+
+    // The loader only keeps a weak reference to the storage, 
+    // the loading is skipped if all the handles are dropped before
+    std::weak_ptr<AssetStorage<AssetType>> weak_storage = new_storage;
+    u64 load_version = new_storage->version();
+    
+    thread_pool_p->submit(
+        [weak_storage, load_version, info = asset_info.value()]() mutable {
+            if (weak_storage.expired())
+                return;
+
+            std::unique_ptr<AssetType> asset_p;
+            
+            try {
+                asset_p = loadAsset<AssetType>(info);
+            } catch (std::exception& e) {
+                log::core::error(
+                    "Error during asset \"{}\" loading: {}",
+                    info.assetName(),
+                    e.what()
+                );
+
+                return;
+            }
+
+            // Publish the asset if it's still referenced, the asset
+            // is discarded if an update replaced it in the meantime
+            if (auto storage = weak_storage.lock()) {
+                storage->publishAsset(load_version, std::move(asset_p));
+            }
+        }
+    );
+
+    return AssetHandle<AssetType>(new_storage);
+}
+
 // Take a parser and update the current cached assets
 template<typename... AssetTypes>
 void AssetsCache<AssetTypes...>::updateAssets(
-    const AssetParser<AssetTypes...>& parser
+    const AssetParser<AssetTypes...>& parser,
+    ThreadPool* thread_pool_p
+) {
+    // Collect the reload tasks of every cache type in the tuple
+    std::vector<std::function<void(void)>> reload_tasks;
+    
+    auto _ = { 
+        (updateAssetsCache<AssetTypes>(parser, reload_tasks), 0)... 
+    };
+
+    runReloadTasks(reload_tasks, thread_pool_p);
+}
+
+// Reload only the changed cached assets
+template<typename... AssetTypes>
+void AssetsCache<AssetTypes...>::updateChangedAssets(
+    const AssetParser<AssetTypes...>& parser,
+    const AssetNameSets<AssetTypes...>& changed_names,
+    const std::unordered_set<std::string>& changed_files,
+    ThreadPool* thread_pool_p
 ) {
-    // Call update cache for each cache type in the tuple
+    std::vector<std::function<void(void)>> reload_tasks;
+    
+    auto _ = { 
+        (updateChangedCache<AssetTypes>(
+            parser, 
+            std::get<AssetNameSet<AssetTypes>>(changed_names),
+            changed_files,
+            reload_tasks
+        ), 0)... 
+    };
+
+    runReloadTasks(reload_tasks, thread_pool_p);
+}
+
+// Call the given function with the info of every cached asset
+template<typename... AssetTypes>
+template <typename Fn>
+void AssetsCache<AssetTypes...>::forEachInfo(Fn fn)
+{
+    auto for_each_cached = [&fn](auto& cache) {
+        for (auto& asset_pair : cache) {
+            if (auto asset = asset_pair.second.lock())
+                fn(asset->info());
+        }
+    };
+
     auto _ = { 
-        (updateAssetsCache<AssetTypes>(parser), 0)... 
+        (for_each_cached(std::get<Cache<AssetTypes>>(m_caches)), 0)... 
     };
 }
 
@@ -139,35 +315,106 @@ void AssetsCache<AssetTypes...>::updateAssets(
 template<typename... AssetTypes>
 template <typename AssetType>
 void AssetsCache<AssetTypes...>::updateAssetsCache(
-    const AssetParser<AssetTypes...>& parser
+    const AssetParser<AssetTypes...>& parser,
+    std::vector<std::function<void(void)>>& reload_tasks
 ) {
     for (auto& asset_pair : std::get<Cache<AssetType>>(m_caches)) {
-        std::string key = asset_pair.first;
-
         // If the asset is expired don't update it
         if (asset_pair.second.expired()) {
             continue;
         }
 
-        // Lock the shared pointer
+        queueReload<AssetType>(
+            asset_pair.first,
+            asset_pair.second.lock(),
+            parser.template getInfo<AssetType>(asset_pair.first),
+            reload_tasks
+        );
+    }
+}
+
+// Update the changed assets in the cache of a given type
+template<typename... AssetTypes>
+template <typename AssetType>
+void AssetsCache<AssetTypes...>::updateChangedCache(
+    const AssetParser<AssetTypes...>& parser,
+    const AssetNameSet<AssetType>& changed_names,
+    const std::unordered_set<std::string>& changed_files,
+    std::vector<std::function<void(void)>>& reload_tasks
+) {
+    for (auto& asset_pair : std::get<Cache<AssetType>>(m_caches)) {
         std::shared_ptr<AssetStorage<AssetType>> asset =
             asset_pair.second.lock();
 
-        log::core::debug("Updating asset: \"{}\"", key);
+        // If the asset is expired don't update it
+        if (asset == nullptr) {
+            continue;
+        }
 
-        // Obtain the new asset info from the parser
-        std::optional<AssetInfo<AssetType>> info = 
-            parser.template getInfo<AssetType>(key);
+        bool changed = changed_names.names.contains(asset_pair.first);
+
+        // Check if one of the asset source files changed
+        if (!changed && !changed_files.empty()) {
+            for (auto& path : assetSourcePaths<AssetType>(asset->info())) {
+                if (path.empty())
+                    continue;
+
+                auto normal_path = FileWatcher::normalize(path).string();
+
+                if (changed_files.contains(normal_path)) {
+                    changed = true;
+                    break;
+                }
+            }
+        }
+
+        if (!changed) {
+            continue;
+        }
+
+        queueReload<AssetType>(
+            asset_pair.first,
+            asset,
+            parser.template getInfo<AssetType>(asset_pair.first),
+            reload_tasks
+        );
+    }
+}
+
+// Append the task reloading the given asset with the new info
+template<typename... AssetTypes>
+template <typename AssetType>
+void AssetsCache<AssetTypes...>::queueReload(
+    const std::string& key,
+    std::shared_ptr<AssetStorage<AssetType>> asset,
+    std::optional<AssetInfo<AssetType>> info,
+    std::vector<std::function<void(void)>>& reload_tasks
+) {
+    // If the asset is no longer in the table make it unavailable
+    if (!info.has_value()) {
+        log::core::warn(
+            "The asset \"{}\" is now unavailable (not in the asset table)",
+            key
+        );
+
+        // Update the asset and make it unavailable
+        asset->updateAsset(AssetInfo<AssetType>(), nullptr);
+
+        return;
+    }
+
+    // Load the new asset in the reload task
+    reload_tasks.push_back(
+        [key, asset, info = info.value()]() mutable {
+            log::core::debug("Updating asset: \"{}\"", key);
 
-        // If the asset was found load the new asset 
-        if (info.has_value()) {
             try {
                 // Try loading the new asset
                 std::unique_ptr<AssetType> new_asset = 
-                    loadAsset<AssetType>(info.value());
+                    loadAsset<AssetType>(info);
                 
                 // Update the asset and make it available
-                asset->updateAsset(info.value(), std::move(new_asset));
+                asset->updateAsset(info, std::move(new_asset));
 
             } catch (std::exception& e) {
                 log::core::warn(
@@ -175,18 +422,29 @@ void AssetsCache<AssetTypes...>::updateAssetsCache(
                     key
                 );
 
-                // Update the asset and make it unavailable
-                asset->updateAsset(AssetInfo<AssetType>(), nullptr);
+                // Update the asset and make it unavailable, the info 
+                // is kept so a fix to the source files reloads it
+                asset->updateAsset(info, nullptr);
             }
-        } else {
-            log::core::warn(
-                "The asset \"{}\" is now unavailable (not in the asset table)",
-                key
-            );
-
-            // Update the asset and make it unavailable
-            asset->updateAsset(AssetInfo<AssetType>(), nullptr);
         }
+    );
+}
+
+// Run the reload tasks on the thread pool and wait for them
+template<typename... AssetTypes>
+void AssetsCache<AssetTypes...>::runReloadTasks(
+    std::vector<std::function<void(void)>>& reload_tasks,
+    ThreadPool* thread_pool_p
+) {
+    // Reload the assets concurrently, every storage is updated by
+    // exactly one task so the readers see either the old or new asset
+    if (thread_pool_p != nullptr) {
+        thread_pool_p->parallelFor(
+            reload_tasks.size(),
+            [&reload_tasks](usize i) { reload_tasks[i](); }
+        );
+    } else {
+        for (auto& task : reload_tasks) { task(); }
     }
 }
 
@@ -0,0 +1,25 @@
+#ifndef CNDT_MESH_CACHE_H
+#define CNDT_MESH_CACHE_H
+
+#include "conduit/assets/mesh.h"
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+
+namespace cndt::internal {
+
+// Directory storing the preprocessed binary meshes
+constexpr const char* mesh_cache_dir = "cache/meshes";
+
+// Load the mesh imported from the given source file from its binary 
+// cache, on a cache miss or if the source changed the mesh is imported 
+// with the given function and the cache is written again
+std::unique_ptr<Mesh> loadCachedMesh(
+    const std::filesystem::path& source_path,
+    const std::function<std::unique_ptr<Mesh>(void)>& import_fn
+);
+
+} // namespace cndt::internal
+
+#endif
@@ -1,19 +1,23 @@
 #ifndef CNDT_DELETE_QUEUE
 #define CNDT_DELETE_QUEUE
 
-#include <functional>
+#include "conduit/internal/core/inplaceFunction.h"
+
 #include <vector>
 
 namespace cndt {
 
 // Call the deleter functions in the opposite order to hot they were added
 class DeleteQueue {
+    // Deleter function type, the captures are stored inline
+    using DeleterFn = InplaceFunction<void(void)>;
+
 public:
     DeleteQueue() = default;
     ~DeleteQueue() = default;
 
     // Add a deleter to the deleter queue
-    void addDeleter(std::function<void(void)> deleter_fun);
+    void addDeleter(DeleterFn deleter_fun);
 
     // Call all of the deleter functions in the queue
     void callDeleter();
@@ -23,7 +27,7 @@ public:
 
 private:
     // Store the deleter functions
-    std::vector<std::function<void(void)>> m_deleters;
+    std::vector<DeleterFn> m_deleters;
 };
 
 } // namespace cndt
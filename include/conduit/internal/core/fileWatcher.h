@@ -0,0 +1,74 @@
+#ifndef CNDT_FILE_WATCHER_H
+#define CNDT_FILE_WATCHER_H
+
+#include "conduit/defines.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace cndt {
+
+// Report the changes of a set of files, on Linux the file directories
+// are watched with inotify, other platforms compare the modification time
+//
+// Rapid changes of the same file are coalesced, a file is reported
+// once it was not modified for the debounce interval
+class FileWatcher {
+    using SteadyClock = std::chrono::steady_clock;
+
+public:
+    FileWatcher(
+        std::chrono::milliseconds debounce = std::chrono::milliseconds(200)
+    );
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // Start watching the given file, watching a file twice has no effect
+    void watch(const std::filesystem::path& file_path);
+
+    // Return the watched files changed since the last call whose changes
+    // settled for the debounce interval, the paths are absolute
+    std::vector<std::filesystem::path> poll();
+
+    // Return the absolute normal path used to identify the given file
+    static std::filesystem::path normalize(
+        const std::filesystem::path& file_path
+    );
+
+private:
+    // Read the pending change notifications and mark the changed files
+    void readChanges();
+
+    // Mark the given file as changed now
+    void markChanged(const std::filesystem::path& file_path);
+
+private:
+    std::chrono::milliseconds m_debounce;
+
+    // Watched files normal paths
+    std::unordered_set<std::string> m_files;
+
+    // Files without native notifications and their last known 
+    // modification time, scanned at most once per debounce interval
+    std::unordered_map<std::string, std::filesystem::file_time_type> 
+        m_polled_files;
+    SteadyClock::time_point m_last_scan;
+
+    // Changed files waiting for the debounce interval
+    std::unordered_map<std::string, SteadyClock::time_point> m_pending;
+
+    // Inotify instance and watched directories by watch descriptor
+    i32 m_inotify_fd;
+    std::unordered_map<i32, std::filesystem::path> m_dir_watches;
+    std::unordered_set<std::string> m_watched_dirs;
+};
+
+} // namespace cndt
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef CNDT_FUNCTION_REF_H
+#define CNDT_FUNCTION_REF_H
+
+#include "conduit/defines.h"
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace cndt {
+
+template <typename Signature>
+class FunctionRef;
+
+/*
+ *
+ *      Function reference definition
+ *
+ * */
+
+// Non owning reference to a callable, used for the functions called
+// immediately by the receiver. The referenced callable must outlive
+// the reference, so it should only be used as a function parameter
+template <typename Ret, typename... Args>
+class FunctionRef<Ret(Args...)> {
+public:
+    // Reference the given callable
+    template <
+        typename Fn,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::decay_t<Fn>, FunctionRef> &&
+            std::is_invocable_r_v<Ret, Fn&, Args...>
+        >
+    >
+    FunctionRef(Fn&& fn) noexcept :
+        m_callable_p(
+            const_cast<void*>(static_cast<const void*>(std::addressof(fn)))
+        ),
+        m_invoke_p(&invokeFn<std::remove_reference_t<Fn>>)
+    { }
+
+    FunctionRef(const FunctionRef&) noexcept = default;
+    FunctionRef& operator=(const FunctionRef&) noexcept = default;
+
+    // Call the referenced callable
+    Ret operator()(Args... args) const
+    {
+        return m_invoke_p(m_callable_p, std::forward<Args>(args)...);
+    }
+
+private:
+    template <typename Fn>
+    static Ret invokeFn(void* fn_p, Args&&... args)
+    {
+        if constexpr (std::is_void_v<Ret>) {
+            std::invoke(*static_cast<Fn*>(fn_p), std::forward<Args>(args)...);
+        } else {
+            return std::invoke(
+                *static_cast<Fn*>(fn_p),
+                std::forward<Args>(args)...
+            );
+        }
+    }
+
+private:
+    void* m_callable_p;
+    Ret (*m_invoke_p)(void*, Args&&...);
+};
+
+} // namespace cndt
+
+#endif
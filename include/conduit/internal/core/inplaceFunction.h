@@ -0,0 +1,244 @@
+#ifndef CNDT_INPLACE_FUNCTION_H
+#define CNDT_INPLACE_FUNCTION_H
+
+#include "conduit/defines.h"
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cndt {
+
+// Default inline storage size of the inplace functions
+constexpr usize inplace_function_default_capacity = 64;
+
+template <typename Signature, usize Capacity = inplace_function_default_capacity>
+class InplaceFunction;
+
+/*
+ *
+ *      Inplace function definition
+ *
+ * */
+
+// Copyable type erased callable stored in a fixed size inline buffer.
+//
+// Unlike std::function the callable is never allocated on the heap,
+// callables larger than the capacity are rejected at compile time
+template <typename Ret, typename... Args, usize Capacity>
+class InplaceFunction<Ret(Args...), Capacity> {
+public:
+    // Return true if the callable type can be stored inline
+    template <typename Fn>
+    static constexpr bool fits = sizeof(Fn) <= Capacity &&
+        alignof(Fn) <= alignof(std::max_align_t);
+
+public:
+    // Create an empty function
+    InplaceFunction() noexcept : m_ops_p(nullptr) { }
+    InplaceFunction(std::nullptr_t) noexcept : m_ops_p(nullptr) { }
+
+    // Store a copy of the given callable
+    template <
+        typename Fn,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::decay_t<Fn>, InplaceFunction> &&
+            std::is_invocable_r_v<Ret, std::decay_t<Fn>&, Args...>
+        >
+    >
+    InplaceFunction(Fn&& fn);
+
+    InplaceFunction(const InplaceFunction& other);
+    InplaceFunction(InplaceFunction&& other) noexcept;
+
+    InplaceFunction& operator=(const InplaceFunction& other);
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept;
+    InplaceFunction& operator=(std::nullptr_t) noexcept;
+
+    ~InplaceFunction() { reset(); }
+
+    // Call the stored callable, throw if the function is empty
+    Ret operator()(Args... args) const;
+
+    // Return true if the function store a callable
+    explicit operator bool() const noexcept { return m_ops_p != nullptr; }
+
+private:
+    // Type specific operations on the stored callable
+    struct Ops {
+        Ret (*invoke)(void*, Args&&...);
+        void (*copy)(void*, const void*);
+        void (*move)(void*, void*) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template <typename Fn>
+    static Ret invokeFn(void* fn_p, Args&&... args)
+    {
+        if constexpr (std::is_void_v<Ret>) {
+            std::invoke(*static_cast<Fn*>(fn_p), std::forward<Args>(args)...);
+        } else {
+            return std::invoke(
+                *static_cast<Fn*>(fn_p),
+                std::forward<Args>(args)...
+            );
+        }
+    }
+
+    template <typename Fn>
+    static void copyFn(void* dest_p, const void* src_p)
+    {
+        ::new (dest_p) Fn(*static_cast<const Fn*>(src_p));
+    }
+
+    template <typename Fn>
+    static void moveFn(void* dest_p, void* src_p) noexcept
+    {
+        ::new (dest_p) Fn(std::move(*static_cast<Fn*>(src_p)));
+        static_cast<Fn*>(src_p)->~Fn();
+    }
+
+    template <typename Fn>
+    static void destroyFn(void* fn_p) noexcept
+    {
+        static_cast<Fn*>(fn_p)->~Fn();
+    }
+
+    template <typename Fn>
+    static constexpr Ops fn_ops = {
+        &invokeFn<Fn>,
+        &copyFn<Fn>,
+        &moveFn<Fn>,
+        &destroyFn<Fn>
+    };
+
+    // Destroy the stored callable
+    void reset() noexcept;
+
+private:
+    const Ops* m_ops_p;
+
+    // Inline callable storage, mutable like the std::function call
+    alignas(std::max_align_t) mutable std::byte m_storage[Capacity];
+};
+
+/*
+ *
+ *      Inplace function implementation
+ *
+ * */
+
+// Store a copy of the given callable
+template <typename Ret, typename... Args, usize Capacity>
+template <typename Fn, typename>
+InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(Fn&& fn)
+{
+    using FnType = std::decay_t<Fn>;
+
+    static_assert(
+        sizeof(FnType) <= Capacity,
+        "Callable captures don't fit in the InplaceFunction capacity"
+    );
+    static_assert(
+        alignof(FnType) <= alignof(std::max_align_t),
+        "Callable alignment not supported by InplaceFunction"
+    );
+    static_assert(
+        std::is_copy_constructible_v<FnType>,
+        "InplaceFunction callables must be copy constructible"
+    );
+
+    ::new (static_cast<void*>(m_storage)) FnType(std::forward<Fn>(fn));
+    m_ops_p = &fn_ops<FnType>;
+}
+
+template <typename Ret, typename... Args, usize Capacity>
+InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(
+    const InplaceFunction& other
+) :
+    m_ops_p(other.m_ops_p)
+{
+    if (m_ops_p != nullptr)
+        m_ops_p->copy(m_storage, other.m_storage);
+}
+
+template <typename Ret, typename... Args, usize Capacity>
+InplaceFunction<Ret(Args...), Capacity>::InplaceFunction(
+    InplaceFunction&& other
+) noexcept :
+    m_ops_p(other.m_ops_p)
+{
+    if (m_ops_p != nullptr) {
+        m_ops_p->move(m_storage, other.m_storage);
+        other.m_ops_p = nullptr;
+    }
+}
+
+template <typename Ret, typename... Args, usize Capacity>
+InplaceFunction<Ret(Args...), Capacity>&
+InplaceFunction<Ret(Args...), Capacity>::operator=(
+    const InplaceFunction& other
+) {
+    if (this != &other) {
+        reset();
+
+        if (other.m_ops_p != nullptr) {
+            other.m_ops_p->copy(m_storage, other.m_storage);
+            m_ops_p = other.m_ops_p;
+        }
+    }
+
+    return *this;
+}
+
+template <typename Ret, typename... Args, usize Capacity>
+InplaceFunction<Ret(Args...), Capacity>&
+InplaceFunction<Ret(Args...), Capacity>::operator=(
+    InplaceFunction&& other
+) noexcept {
+    if (this != &other) {
+        reset();
+
+        if (other.m_ops_p != nullptr) {
+            other.m_ops_p->move(m_storage, other.m_storage);
+            m_ops_p = other.m_ops_p;
+            other.m_ops_p = nullptr;
+        }
+    }
+
+    return *this;
+}
+
+template <typename Ret, typename... Args, usize Capacity>
+InplaceFunction<Ret(Args...), Capacity>&
+InplaceFunction<Ret(Args...), Capacity>::operator=(std::nullptr_t) noexcept
+{
+    reset();
+    return *this;
+}
+
+// Call the stored callable, throw if the function is empty
+template <typename Ret, typename... Args, usize Capacity>
+Ret InplaceFunction<Ret(Args...), Capacity>::operator()(Args... args) const
+{
+    if (m_ops_p == nullptr)
+        throw std::bad_function_call();
+
+    return m_ops_p->invoke(m_storage, std::forward<Args>(args)...);
+}
+
+// Destroy the stored callable
+template <typename Ret, typename... Args, usize Capacity>
+void InplaceFunction<Ret(Args...), Capacity>::reset() noexcept
+{
+    if (m_ops_p != nullptr) {
+        m_ops_p->destroy(m_storage);
+        m_ops_p = nullptr;
+    }
+}
+
+} // namespace cndt
+
+#endif
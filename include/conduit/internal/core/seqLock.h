@@ -0,0 +1,131 @@
+#ifndef CNDT_SEQ_LOCK_H
+#define CNDT_SEQ_LOCK_H
+
+#include "conduit/defines.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace cndt::internal {
+
+/*
+ *
+ *      Sequence lock definition
+ *
+ * */
+
+// Value written by a single writer thread and read by any number of
+// reader threads without locking.
+//
+// The writer bumps a sequence counter around every store, the readers
+// retry the copy when the counter changed while they were reading.
+// The value is stored as atomic words so the racing copies are defined
+template <typename T>
+class SeqLock {
+    static_assert(
+        std::is_trivially_copyable_v<T>,
+        "SeqLock values must be trivially copyable"
+    );
+
+    // Number of words used to store the value
+    static constexpr usize word_count = (sizeof(T) + sizeof(u64) - 1) /
+        sizeof(u64);
+
+public:
+    SeqLock();
+    SeqLock(const T& value);
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    // Store a new value, must be called only from the writer thread
+    void store(const T& value);
+
+    // Return a consistent copy of the last stored value
+    T load() const;
+
+    // Return the number of stores since the creation
+    u64 version() const;
+
+private:
+    // Even when the value is stable, odd while a store is running
+    std::atomic<u64> m_sequence;
+
+    std::array<std::atomic<u64>, word_count> m_words;
+};
+
+/*
+ *
+ *      Sequence lock implementation
+ *
+ * */
+
+template <typename T>
+SeqLock<T>::SeqLock() : SeqLock(T{})
+{ }
+
+template <typename T>
+SeqLock<T>::SeqLock(const T& value) :
+    m_sequence(0),
+    m_words()
+{
+    store(value);
+    m_sequence.store(0, std::memory_order_release);
+}
+
+// Store a new value
+template <typename T>
+void SeqLock<T>::store(const T& value)
+{
+    std::array<u64, word_count> words = {};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    u64 sequence = m_sequence.load(std::memory_order_relaxed);
+
+    // Mark the value as being written before touching the words
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (usize i = 0; i < word_count; i++) {
+        m_words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Return a consistent copy of the last stored value
+template <typename T>
+T SeqLock<T>::load() const
+{
+    std::array<u64, word_count> words;
+
+    u64 begin_sequence, end_sequence;
+    do {
+        begin_sequence = m_sequence.load(std::memory_order_acquire);
+
+        for (usize i = 0; i < word_count; i++) {
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        end_sequence = m_sequence.load(std::memory_order_relaxed);
+    } while (begin_sequence != end_sequence || (begin_sequence & 1) != 0);
+
+    T value;
+    std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+
+    return value;
+}
+
+// Return the number of stores since the creation
+template <typename T>
+u64 SeqLock<T>::version() const
+{
+    return m_sequence.load(std::memory_order_acquire) / 2;
+}
+
+} // namespace cndt::internal
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef CNDT_SPSC_QUEUE_H
+#define CNDT_SPSC_QUEUE_H
+
+#include "conduit/defines.h"
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <type_traits>
+
+namespace cndt::internal {
+
+// Size used to keep the producer and consumer indices on different
+// cache lines, avoiding false sharing between the two threads
+constexpr usize spsc_cache_line_size = 64;
+
+/*
+ *
+ *      Single producer single consumer queue definition
+ *
+ * */
+
+// Bounded lock free queue used to move values from exactly one
+// producer thread to exactly one consumer thread.
+//
+// The capacity is rounded up to a power of two, every slot is
+// preallocated so pushing and popping never allocates or locks
+template <typename T>
+class SpscQueue {
+    static_assert(
+        std::is_trivially_copyable_v<T>,
+        "SpscQueue values must be trivially copyable"
+    );
+
+public:
+    SpscQueue(usize capacity);
+    ~SpscQueue() = default;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Append a value to the queue, return false if the queue is full.
+    // Must be called only from the producer thread
+    bool push(const T& value);
+
+    // Remove the oldest value from the queue, return false if the queue
+    // is empty. Must be called only from the consumer thread
+    bool pop(T& out_value);
+
+    // Return the number of stored values, the result is only
+    // approximated while the other thread is using the queue
+    usize size() const;
+
+    // Return the maximum number of stored values
+    usize capacity() const { return m_mask + 1; }
+
+private:
+    // Ring buffer storage
+    std::unique_ptr<T[]> m_slots_p;
+    usize m_mask;
+
+    // Next slot written by the producer
+    alignas(spsc_cache_line_size) std::atomic<usize> m_tail;
+    // Consumer index cached by the producer
+    usize m_cached_head;
+
+    // Next slot read by the consumer
+    alignas(spsc_cache_line_size) std::atomic<usize> m_head;
+    // Producer index cached by the consumer
+    usize m_cached_tail;
+};
+
+/*
+ *
+ *      Single producer single consumer queue implementation
+ *
+ * */
+
+template <typename T>
+SpscQueue<T>::SpscQueue(usize capacity) :
+    m_slots_p(),
+    m_mask(std::bit_ceil(capacity < 2 ? usize(2) : capacity) - 1),
+    m_tail(0),
+    m_cached_head(0),
+    m_head(0),
+    m_cached_tail(0)
+{
+    m_slots_p = std::make_unique<T[]>(m_mask + 1);
+}
+
+// Append a value to the queue, return false if the queue is full
+template <typename T>
+bool SpscQueue<T>::push(const T& value)
+{
+    usize tail = m_tail.load(std::memory_order_relaxed);
+
+    // Reload the consumer index only when the cached one says full
+    if (tail - m_cached_head > m_mask) {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+
+        if (tail - m_cached_head > m_mask)
+            return false;
+    }
+
+    m_slots_p[tail & m_mask] = value;
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+// Remove the oldest value from the queue, return false if it's empty
+template <typename T>
+bool SpscQueue<T>::pop(T& out_value)
+{
+    usize head = m_head.load(std::memory_order_relaxed);
+
+    // Reload the producer index only when the cached one says empty
+    if (head == m_cached_tail) {
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+        if (head == m_cached_tail)
+            return false;
+    }
+
+    out_value = m_slots_p[head & m_mask];
+    m_head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+// Return the number of stored values
+template <typename T>
+usize SpscQueue<T>::size() const
+{
+    usize head = m_head.load(std::memory_order_acquire);
+    usize tail = m_tail.load(std::memory_order_acquire);
+
+    return tail - head;
+}
+
+} // namespace cndt::internal
+
+#endif
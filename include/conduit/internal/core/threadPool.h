@@ -0,0 +1,80 @@
+#ifndef CNDT_THREAD_POOL_H
+#define CNDT_THREAD_POOL_H
+
+#include "conduit/defines.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cndt {
+
+// Fixed size pool of worker threads executing tasks in submission order
+class ThreadPool {
+public:
+    // Create the pool with the given number of worker threads,
+    // zero use one thread less than the available hardware threads
+    ThreadPool(usize thread_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Add a task to the pool queue
+    void submit(std::function<void(void)> task);
+
+    // Add a task to the pool queue and return a future to its result
+    template <typename Fn>
+    auto async(Fn fn) -> std::future<std::invoke_result_t<Fn>>;
+
+    // Call the given function for every index in the range [0, count)
+    // distributing the indices on the workers and wait for completion,
+    // the calling thread also execute part of the indices
+    void parallelFor(usize count, const std::function<void(usize)>& fn);
+
+    // Return the number of worker threads
+    usize threadCount() const { return m_workers.size(); }
+
+private:
+    // Worker threads main loop
+    void workerLoop();
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_task_cv;
+
+    // Pending tasks queue
+    std::deque<std::function<void(void)>> m_tasks;
+
+    // Set to stop the workers on pool destruction
+    bool m_stop;
+
+    std::vector<std::thread> m_workers;
+};
+
+// Add a task to the pool queue and return a future to its result
+template <typename Fn>
+auto ThreadPool::async(Fn fn) -> std::future<std::invoke_result_t<Fn>>
+{
+    using Result = std::invoke_result_t<Fn>;
+
+    // The packaged task is not copyable so it's stored in a shared pointer
+    auto task_p = std::make_shared<std::packaged_task<Result()>>(
+        std::move(fn)
+    );
+    std::future<Result> result = task_p->get_future();
+
+    submit([task_p]() { (*task_p)(); });
+
+    return result;
+}
+
+} // namespace cndt
+
+#endif
@@ -4,10 +4,17 @@
 #include "conduit/logging.h"
 
 #include "conduit/ecs/entity.h"
+#include "conduit/ecs/entityRange.h"
+#include "conduit/ecs/entityRemap.h"
+#include "conduit/ecs/worldStats.h"
 
 #include <algorithm>
+#include <cstring>
+#include <iterator>
 #include <mutex>
 #include <shared_mutex>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
 namespace cndt::internal {
@@ -20,6 +27,21 @@ public:
 
     // Remove the component from the buffer
     virtual void detachComponent(Entity entity) = 0;
+
+    // Return the buffer memory usage statistics
+    virtual ComponentBufferStats stats() = 0;
+
+    // Apply the remap to all the entities in the buffer
+    virtual void remapEntities(const EntityRemap& remap) = 0;
+
+    // Move all the components of the other buffer to the end of this 
+    // buffer applying the remap, the other buffer must store the 
+    // same component type and the remapped entities must be greater 
+    // than all the entities already in the buffer
+    virtual void mergeBuffer(
+        ComponentBufferBase& other, 
+        const EntityRemap& remap
+    ) = 0;
 };
 
 // Store all the component 
@@ -30,7 +52,7 @@ private:
     using ComponentIterator = typename std::vector<CompType>::iterator;
     
 public:
-    ComponentBuffer() = default;
+    ComponentBuffer() : m_version(0) { };
     ~ComponentBuffer() = default;
 
     // Add a component to the buffer using the component constructor
@@ -40,9 +62,25 @@ public:
     // Copy the given component to the buffer
     void attachComponent(Entity entity, CompType &component);
 
+    // Attach a copy of the given component to every entity in the range
+    void appendComponents(const EntityRange& range, const CompType& component);
+
     // Remove the component from the buffer
     void detachComponent(Entity entity) override;
 
+    // Return the buffer memory usage statistics
+    ComponentBufferStats stats() override;
+
+    // Apply the remap to all the entities in the buffer
+    void remapEntities(const EntityRemap& remap) override;
+
+    // Move all the components of the other buffer 
+    // to the end of this buffer applying the remap
+    void mergeBuffer(
+        ComponentBufferBase& other, 
+        const EntityRemap& remap
+    ) override;
+
     // Get a reference to the entity vector 
     std::vector<Entity>& entityVector() { return m_entity_buffer; }
 
@@ -172,6 +210,72 @@ void ComponentBuffer<CompType>::attachComponent(
     }
 }
 
+// Attach a copy of the given component to every entity in the range
+template <typename CompType>
+void ComponentBuffer<CompType>::appendComponents(
+    const EntityRange& range,
+    const CompType& component
+) {
+    if (range.empty())
+        return;
+
+    // The range must be above all the stored entities to keep the order
+    bool range_sorted = true;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        
+        range_sorted = 
+            m_entity_buffer.empty() || m_entity_buffer.back() < range[0];
+    }
+
+    // Fall back to one insert per entity if the range is not sorted
+    if (!range_sorted) {
+        log::core::warn(
+            "ComponentBuffer::appendComponents -> range is not sorted"
+        );
+        
+        for (usize i = 0; i < range.size(); i++) {
+            CompType copy = component;
+            attachComponent(range[i], copy);
+        }
+
+        return;
+    }
+
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+
+    usize old_size = m_entity_buffer.size();
+    usize count = range.size();
+
+    m_entity_buffer.resize(old_size + count);
+    for (usize i = 0; i < count; i++) {
+        m_entity_buffer[old_size + i] = range[i];
+    }
+
+    if constexpr (
+        std::is_trivially_copyable_v<CompType> && 
+        std::is_default_constructible_v<CompType>
+    ) {
+        // Fill the new components doubling the copied block every step
+        m_component_buffer.resize(old_size + count);
+        
+        CompType* first_p = m_component_buffer.data() + old_size;
+        std::memcpy(first_p, &component, sizeof(CompType));
+
+        usize copied = 1;
+        while (copied < count) {
+            usize block = std::min(copied, count - copied);
+            std::memcpy(first_p + copied, first_p, block * sizeof(CompType));
+
+            copied += block;
+        }
+    } else {
+        m_component_buffer.insert(m_component_buffer.end(), count, component);
+    }
+
+    m_version += 1;
+}
+
 // Remove the component from the buffer
 template <typename CompType>
 void ComponentBuffer<CompType>::detachComponent(Entity entity) 
@@ -192,6 +296,82 @@ void ComponentBuffer<CompType>::detachComponent(Entity entity)
     }
 }
 
+// Return the buffer memory usage statistics
+template <typename CompType>
+ComponentBufferStats ComponentBuffer<CompType>::stats()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    usize entity_bytes = m_entity_buffer.capacity() * sizeof(Entity);
+    usize component_bytes = m_component_buffer.capacity() * sizeof(CompType);
+
+    return ComponentBufferStats {
+        .type_name = typeid(CompType).name(),
+        .count = m_component_buffer.size(),
+        .capacity = m_component_buffer.capacity(),
+        .bytes = entity_bytes + component_bytes
+    };
+}
+
+// Apply the remap to all the entities in the buffer
+template <typename CompType>
+void ComponentBuffer<CompType>::remapEntities(const EntityRemap& remap)
+{
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+
+    // The remap is an offset so the entities order is preserved
+    for (auto& entity : m_entity_buffer) {
+        entity = remap.remap(entity);
+    }
+
+    m_version += 1;
+}
+
+// Move all the components of the other buffer 
+// to the end of this buffer applying the remap
+template <typename CompType>
+void ComponentBuffer<CompType>::mergeBuffer(
+    ComponentBufferBase& other, 
+    const EntityRemap& remap
+) {
+    auto& other_buffer = static_cast<ComponentBuffer<CompType>&>(other);
+    
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+    std::lock_guard<std::shared_mutex> other_lock(other_buffer.m_mutex);
+
+    // Steal the other buffer vectors if this buffer is empty
+    if (m_entity_buffer.empty()) {
+        m_entity_buffer.swap(other_buffer.m_entity_buffer);
+        m_component_buffer.swap(other_buffer.m_component_buffer);
+
+        for (auto& entity : m_entity_buffer) {
+            entity = remap.remap(entity);
+        }
+    } else {
+        usize old_size = m_entity_buffer.size();
+        
+        m_entity_buffer.resize(old_size + other_buffer.m_entity_buffer.size());
+        std::transform(
+            other_buffer.m_entity_buffer.begin(),
+            other_buffer.m_entity_buffer.end(),
+            m_entity_buffer.begin() + old_size,
+            [&](Entity entity) { return remap.remap(entity); }
+        );
+
+        m_component_buffer.insert(
+            m_component_buffer.end(),
+            std::make_move_iterator(other_buffer.m_component_buffer.begin()),
+            std::make_move_iterator(other_buffer.m_component_buffer.end())
+        );
+    }
+
+    other_buffer.m_entity_buffer.clear();
+    other_buffer.m_component_buffer.clear();
+
+    m_version += 1;
+    other_buffer.m_version += 1;
+}
+
 } // namespace cndt::internal
 
 #endif
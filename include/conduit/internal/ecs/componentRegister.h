@@ -3,12 +3,15 @@
 #define CNDT_ECS_COMPONENT_REG_H
 
 #include "conduit/ecs/entity.h"
+#include "conduit/ecs/entityRemap.h"
+#include "conduit/ecs/worldStats.h"
 #include "conduit/internal/ecs/ComponentTypeRegister.h"
 #include "conduit/internal/ecs/componentBuffer.h"
 
 #include <map>
 #include <memory>
 #include <shared_mutex>
+#include <vector>
 
 namespace cndt::internal {
 
@@ -26,6 +29,10 @@ public:
     template <typename CompType>
     void attachComponent(Entity entity, CompType &component);
     
+    // Attach a copy of the given component to every entity in the range
+    template <typename CompType>
+    void appendComponents(const EntityRange& range, const CompType& component);
+    
     // Detach a component from the given entity
     template <typename CompType>
     void detachComponent(Entity entity);
@@ -33,6 +40,13 @@ public:
     // Detach all the components from the given entity
     void detachAllComponets(Entity entity);
 
+    // Move all the components of the other register to this register
+    // applying the remap, the other register is left empty
+    void merge(ComponentRegister& other, const EntityRemap& remap);
+
+    // Return the memory usage statistics of all the component buffers
+    std::vector<ComponentBufferStats> stats();
+
     // Get an component buffer for the specific type
     // if the component doesn't exist create it
     template<class CompType>
@@ -116,6 +130,28 @@ void ComponentRegister::attachComponent(Entity entity, CompType &component)
     buffer->attachComponent(entity, component);
 }
 
+// Attach a copy of the given component to every entity in the range
+template <typename CompType>
+void ComponentRegister::appendComponents(
+    const EntityRange& range, 
+    const CompType& component
+) {
+    // Create the buffer if it doesn't already exist
+    addComponetType<CompType>();
+    
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    
+    // Get a reference to the component buffer and add the components to it
+    auto type_id = ComponentTypeRegister::getTypeId<CompType>();
+    
+    std::shared_ptr<ComponentBuffer<CompType>> buffer =
+        std::static_pointer_cast<ComponentBuffer<CompType>>(
+            m_component_buffers[type_id]
+        );
+
+    buffer->appendComponents(range, component);
+}
+
 // Detach a component from the given entity
 template <typename CompType>
 void ComponentRegister::detachComponent(Entity entity)
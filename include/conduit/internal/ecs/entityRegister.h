@@ -2,6 +2,8 @@
 #define CNDT_ECS_ENTITY_REG_H
 
 #include "conduit/ecs/entity.h"
+#include "conduit/ecs/entityRange.h"
+#include "conduit/ecs/entityRemap.h"
 
 #include <vector>
 
@@ -14,8 +16,22 @@ public:
     
     Entity newEntity();
 
+    // Create the given number of entities with contiguous ids,
+    // the free list is not used
+    EntityRange newEntityRange(usize count);
+
     void deleteEntity(Entity entity);
 
+    // Move the other register entities to a new id range 
+    // and reset the other register, return the id remap
+    EntityRemap merge(EntityRegister& other);
+
+    // Return the number of alive entities
+    usize entityCount() const;
+
+    // Return the number of entity ids stored in the free list
+    usize freeEntityCount() const { return m_free_entity_list.size(); }
+
 private:
     // Last assigned entity
     Entity::EntityId m_last_entity_id;
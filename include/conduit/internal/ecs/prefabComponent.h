@@ -0,0 +1,42 @@
+#ifndef CNDT_ECS_PREFAB_COMPONENT_H
+#define CNDT_ECS_PREFAB_COMPONENT_H
+
+#include "conduit/ecs/entityRange.h"
+#include "conduit/internal/ecs/componentRegister.h"
+
+namespace cndt::internal {
+
+// Generic base prefab component class
+class PrefabComponentBase {
+public:
+    PrefabComponentBase() = default;
+    virtual ~PrefabComponentBase() = default;
+
+    // Attach a copy of the stored component to every entity in the range
+    virtual void instantiate(
+        ComponentRegister& comp_register,
+        const EntityRange& range
+    ) const = 0;
+};
+
+// Store a pre-built component value of a prefab
+template <typename CompType>
+class PrefabComponent : public PrefabComponentBase {
+public:
+    PrefabComponent(const CompType& component) : m_component(component) { }
+
+    // Attach a copy of the stored component to every entity in the range
+    void instantiate(
+        ComponentRegister& comp_register,
+        const EntityRange& range
+    ) const override {
+        comp_register.appendComponents<CompType>(range, m_component);
+    }
+
+private:
+    CompType m_component;
+};
+
+} // namespace cndt::internal
+
+#endif
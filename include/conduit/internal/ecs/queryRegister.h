@@ -2,6 +2,7 @@
 #define CNDT_ECS_QUERY_REGISTER_H
 
 #include "conduit/ecs/query.h"
+#include "conduit/ecs/worldStats.h"
 #include "conduit/internal/ecs/QueryTypeRegister.h"
 #include "conduit/internal/ecs/componentRegister.h"
 #include "conduit/internal/ecs/queryStorage.h"
@@ -10,6 +11,7 @@
 #include <memory>
 #include <shared_mutex>
 #include <tuple>
+#include <vector>
 
 namespace cndt::internal {
 
@@ -21,6 +23,12 @@ public:
     // or create a new query storage if it doesn't
     template<typename... CompTypes>
     Query<CompTypes...> getQuery(ComponentRegister &comp_register);
+
+    // Return the rebuild statistics of all the cached query storages
+    std::vector<QueryStorageStats> stats();
+
+    // Remove all the cached query storages
+    void clear();
     
 private:
     // Add the query storage to the register if it doesn't already exist
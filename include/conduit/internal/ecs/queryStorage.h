@@ -4,13 +4,17 @@
 #include "conduit/ecs/entity.h"
 #include "conduit/ecs/query.h"
 #include "conduit/ecs/queryElement.h"
+#include "conduit/ecs/worldStats.h"
+#include "conduit/time.h"
 
 #include "conduit/internal/ecs/componentBuffer.h"
 
 #include <array>
 #include <memory>
 #include <shared_mutex>
+#include <string>
 #include <tuple>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
@@ -20,6 +24,9 @@ class QueryStorageBase {
 public:
     QueryStorageBase() = default;
     virtual ~QueryStorageBase() = default;
+
+    // Return the query rebuild statistics
+    virtual QueryStorageStats stats() const = 0;
 };
 
 // ECS query storage
@@ -43,12 +50,22 @@ public:
     QueryStorage() = default; 
     QueryStorage(
         std::tuple<std::weak_ptr<Buffer<CompTypes>>...> buffer_p
-    ) : m_component_buffers(buffer_p), m_elements(), m_last_version() { }
+    ) : 
+        m_component_buffers(buffer_p),
+        m_elements(),
+        m_last_version(),
+        m_rebuild_count(0),
+        m_last_rebuild_ns(0),
+        m_total_rebuild_ns(0)
+    { }
 
 public:
     // Return a Query handle from the storage
     Query<CompTypes...> createQuery();
 
+    // Return the query rebuild statistics
+    QueryStorageStats stats() const override;
+
 private:
     // Get the buffers version
     u64 buffersVersion();
@@ -92,6 +109,11 @@ private:
     
     // Buffers last version
     u64 m_last_version;
+
+    // Query rebuild statistics
+    u64 m_rebuild_count;
+    u64 m_last_rebuild_ns;
+    u64 m_total_rebuild_ns;
 };
 
 // TODO This code is a mess to be fixed as soon as I 
@@ -116,6 +138,12 @@ void QueryStorage<CompTypes...>::updateQuery()
     // Store a list of indices for the components iterator
     std::array<usize, iter_count> index_list = {};
     
+    // If one of the buffers is empty the query is empty as well
+    for (usize i = 0; i < iter_count; i++) {
+        if (entity_iter[i] == entity_iter_end[i])
+            return;
+    }
+    
     // Use the element 0 as the algorithm pivot point
     EntityIter& pivot = entity_iter[0];
     EntityIter& pivot_end = entity_iter_end[0];
@@ -269,8 +297,15 @@ Query<CompTypes...> QueryStorage<CompTypes...>::createQuery()
     u64 new_version = buffersVersion();
 
     if (new_version != m_last_version) {
+        time::StopWatch rebuild_time;
+        
         updateQuery();
         m_last_version = new_version;
+
+        // Update the rebuild statistics
+        m_last_rebuild_ns = rebuild_time.elapsedNs();
+        m_total_rebuild_ns += m_last_rebuild_ns;
+        m_rebuild_count += 1;
     }
     
     std::array<std::shared_lock<std::shared_mutex>, components_count> locks = 
@@ -295,6 +330,24 @@ auto QueryStorage<CompTypes...>::componentsLocks(std::index_sequence<Is...>)
     return locks; 
 }
 
+// Return the query rebuild statistics
+template <typename... CompTypes>
+QueryStorageStats QueryStorage<CompTypes...>::stats() const
+{
+    // Join the components types names
+    std::string type_name;
+    ((type_name += std::string(typeid(CompTypes).name()) + ", "), ...);
+    type_name.resize(type_name.size() - 2);
+
+    return QueryStorageStats {
+        .type_name = type_name,
+        .rebuild_count = m_rebuild_count,
+        .last_rebuild_ns = m_last_rebuild_ns,
+        .total_rebuild_ns = m_total_rebuild_ns,
+        .element_count = m_elements.size()
+    };
+}
+
 } // namespace cndt::internal
 
 #endif
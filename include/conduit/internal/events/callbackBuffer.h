@@ -2,19 +2,89 @@
 #ifndef CNDT_CALLBACK_BUFFER_H
 #define CNDT_CALLBACK_BUFFER_H
 
+#include "conduit/internal/core/inplaceFunction.h"
 #include "conduit/internal/events/eventBuffer.h"
+#include "conduit/events/eventStats.h"
 #include "conduit/logging.h"
+#include "conduit/time.h"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
+namespace cndt {
+
+// Callback threading mode
+enum class CallbackMode {
+    // The callback is called on the thread updating the bus
+    Serial,
+    // The callback can be called from any thread, concurrently with 
+    // the other types callbacks and with itself on different events
+    ThreadSafe,
+};
+
+// Inline storage size of the event callbacks captures
+constexpr usize event_callback_capacity = 64;
+
+// Event callback function type, the captures are stored inline
+// so registering and calling a callback never allocates
+template <class EventType>
+using EventCallbackFn = InplaceFunction<
+    void(const EventType*),
+    event_callback_capacity
+>;
+
+// Event key extractor function type
+template <class EventType>
+using EventKeyFn = InplaceFunction<
+    u64(const EventType&),
+    event_callback_capacity
+>;
+
+} // namespace cndt
+
 namespace cndt::internal {
 
 // Default size of the callback buffers vectors
 constexpr usize callback_buffer_default_size = 2;
 
+class CallbackBufferBase;
+
+// Range of events to be processed by a single thread safe callback
+struct CallbackJob {
+    CallbackBufferBase* buffer_p;
+
+    // Index of the callback in the buffer
+    usize callback_index;
+
+    // Events range 
+    usize begin;
+    usize end;
+};
+
+// Callback execution time, updated concurrently by the callback jobs
+struct CallbackTiming {
+    std::atomic<u64> event_count = 0;
+    std::atomic<u64> total_ns = 0;
+    std::atomic<u64> max_ns = 0;
+
+    // Add a dispatch of the given number of events and duration
+    void record(u64 events, u64 duration_ns)
+    {
+        event_count.fetch_add(events, std::memory_order_relaxed);
+        total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+
+        u64 max = max_ns.load(std::memory_order_relaxed);
+        while (duration_ns > max && !max_ns.compare_exchange_weak(
+            max, duration_ns, std::memory_order_relaxed
+        )) { }
+    }
+};
+
 // Generic event callback buffer class base
 class CallbackBufferBase {
 public:
@@ -24,13 +94,32 @@ public:
     // Call all the callbacks in the buffer using the events stored
     // in the event buffer provided during the callback buffer construction 
     virtual void callAll() = 0;   
+
+    // Call only the callbacks using the serial mode
+    virtual void callSerial() = 0;
+
+    // Append a job for every chunk of the current events
+    // for every thread safe callback in the buffer
+    virtual void collectJobs(
+        std::vector<CallbackJob>& jobs, 
+        usize chunk_size
+    ) = 0;
+
+    // Call a thread safe callback on the given range of current events
+    virtual void callRange(usize callback_index, usize begin, usize end) = 0;
+
+    // Append the execution time statistics of the callbacks
+    virtual void stats(std::vector<CallbackStats>& out) = 0;
 };
 
 // Type specific event callback buffer class
 template <class EventType>
 class CallbackBuffer : public CallbackBufferBase {
     // Callback function type
-    using CallbackFn = std::function<void(const EventType*)>;
+    using CallbackFn = EventCallbackFn<EventType>;
+
+    // Event key extractor function type
+    using KeyFn = EventKeyFn<EventType>;
 
     // Event buffer weak pointer type for readability
     using EventBufferPtr = std::weak_ptr<EventBuffer<EventType>>;
@@ -42,17 +131,58 @@ public:
     ~CallbackBuffer() = default;
 
     // Add a callback function to the buffer
-    void addCallback(CallbackFn callback_fn);
+    void addCallback(CallbackFn callback_fn, CallbackMode mode);
+
+    // Set the function extracting the dispatch key from the events
+    void setKeyFunction(KeyFn key_fn);
+
+    // Add a callback called only for the events with the given key
+    void addKeyedCallback(u64 key, CallbackFn callback_fn);
     
     // Call all the callbacks in the buffer using the events stored
     // in the event buffer provided during the callback buffer construction 
     void callAll() override;
 
+    // Call only the callbacks using the serial mode
+    void callSerial() override;
+
+    // Append a job for every chunk of the current events
+    // for every thread safe callback in the buffer
+    void collectJobs(
+        std::vector<CallbackJob>& jobs, 
+        usize chunk_size
+    ) override;
+
+    // Call a thread safe callback on the given range of current events
+    void callRange(usize callback_index, usize begin, usize end) override;
+
+    // Append the execution time statistics of the callbacks
+    void stats(std::vector<CallbackStats>& out) override;
+
+private:
+    // Call the callbacks with the given modes on all the current events 
+    void callCallbacks(bool serial, bool thread_safe);
+
 private:
     std::mutex m_mutex;
 
+    // Store a callback function, its threading mode and execution time
+    struct Callback {
+        CallbackFn callback_fn;
+        CallbackMode mode;
+
+        std::unique_ptr<CallbackTiming> timing_p;
+    };
+
     // Callback function buffer
-    std::vector<CallbackFn> m_callback_buffer;
+    std::vector<Callback> m_callback_buffer;
+
+    // Event key extractor and keyed callbacks dispatch table
+    KeyFn m_key_fn;
+    std::unordered_map<u64, std::vector<CallbackFn>> m_keyed_callbacks;
+
+    // Execution time of the whole keyed callbacks dispatch
+    CallbackTiming m_keyed_timing;
     
     // Store the event buffer associated with the callbacks type
     EventBufferPtr m_event_buffer_p;
@@ -78,30 +208,112 @@ CallbackBuffer<EventType>::CallbackBuffer(
 // Add a callback function to the buffer
 template <class EventType>
 void CallbackBuffer<EventType>::addCallback(
-    CallbackBuffer::CallbackFn callback_fn
+    CallbackBuffer::CallbackFn callback_fn,
+    CallbackMode mode
 ) {
     std::unique_lock<std::mutex> lock(m_mutex);
     
     // Add the callback function to the buffer
-    m_callback_buffer.push_back(callback_fn);
+    m_callback_buffer.push_back(Callback {
+        .callback_fn = callback_fn,
+        .mode = mode,
+        .timing_p = std::make_unique<CallbackTiming>()
+    });
+}
+
+// Set the function extracting the dispatch key from the events
+template <class EventType>
+void CallbackBuffer<EventType>::setKeyFunction(CallbackBuffer::KeyFn key_fn) 
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    m_key_fn = key_fn;
+}
+
+// Add a callback called only for the events with the given key
+template <class EventType>
+void CallbackBuffer<EventType>::addKeyedCallback(
+    u64 key,
+    CallbackBuffer::CallbackFn callback_fn
+) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    if (!m_key_fn) {
+        log::core::error(
+            "CallbackBuffer::addKeyedCallback -> "
+            "the event key function is not set; Type: {}",
+            typeid(EventType).name()
+        );
+
+        return;
+    }
+
+    m_keyed_callbacks[key].push_back(callback_fn);
 }
 
 // Call all the callbacks in the buffer
 template <class EventType>
 void CallbackBuffer<EventType>::callAll() 
+{
+    callCallbacks(true, true);
+}
+
+// Call only the callbacks using the serial mode
+template <class EventType>
+void CallbackBuffer<EventType>::callSerial() 
+{
+    callCallbacks(true, false);
+}
+
+// Call the callbacks with the given modes on all the current events 
+template <class EventType>
+void CallbackBuffer<EventType>::callCallbacks(bool serial, bool thread_safe) 
 {
     // Get the current event buffer
     if (auto event_buffer = m_event_buffer_p.lock()) {
         auto current_events = event_buffer->getCurrentEvents();
+        if (current_events->empty())
+            return;
 
         // Run all the callbacks on the buffer
         std::unique_lock<std::mutex> lock(m_mutex);
         
-        for (auto& callback_fn : m_callback_buffer) {
+        for (auto& callback : m_callback_buffer) {
+            bool is_serial = callback.mode == CallbackMode::Serial;
+            if ((is_serial && !serial) || (!is_serial && !thread_safe))
+                continue;
+            
             //  Run the callback for all the new events
+            time::StopWatch callback_time;
+            
             for (auto& event : *current_events) {
-                callback_fn(&event);
+                callback.callback_fn(&event);
             }
+
+            callback.timing_p->record(
+                current_events->size(), 
+                callback_time.elapsedNs()
+            );
+        }
+
+        // Run the keyed callbacks only for the matching events
+        if (serial && !m_keyed_callbacks.empty()) {
+            time::StopWatch keyed_time;
+            
+            for (auto& event : *current_events) {
+                auto keyed_it = m_keyed_callbacks.find(m_key_fn(event));
+                if (keyed_it == m_keyed_callbacks.end())
+                    continue;
+
+                for (auto& callback_fn : keyed_it->second) {
+                    callback_fn(&event);
+                }
+            }
+
+            m_keyed_timing.record(
+                current_events->size(), 
+                keyed_time.elapsedNs()
+            );
         }
         
     } else {
@@ -113,6 +325,99 @@ void CallbackBuffer<EventType>::callAll()
     }
 }
 
+// Append a job for every chunk of the current events
+// for every thread safe callback in the buffer
+template <class EventType>
+void CallbackBuffer<EventType>::collectJobs(
+    std::vector<CallbackJob>& jobs, 
+    usize chunk_size
+) {
+    auto event_buffer = m_event_buffer_p.lock();
+    if (!event_buffer)
+        return;
+    
+    usize event_count = event_buffer->getCurrentEvents()->size();
+    
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (usize i = 0; i < m_callback_buffer.size(); i++) {
+        if (m_callback_buffer[i].mode != CallbackMode::ThreadSafe)
+            continue;
+
+        for (usize begin = 0; begin < event_count; begin += chunk_size) {
+            jobs.push_back(CallbackJob {
+                .buffer_p = this,
+                .callback_index = i,
+                .begin = begin,
+                .end = std::min(begin + chunk_size, event_count)
+            });
+        }
+    }
+}
+
+// Call a thread safe callback on the given range of current events,
+// the callbacks can't be added during the dispatch so the buffer 
+// mutex is not locked
+template <class EventType>
+void CallbackBuffer<EventType>::callRange(
+    usize callback_index, 
+    usize begin, 
+    usize end
+) {
+    if (auto event_buffer = m_event_buffer_p.lock()) {
+        auto snapshot = event_buffer->snapshot();
+        auto& events = *snapshot.current_events_p;
+        
+        auto& callback = m_callback_buffer[callback_index];
+        time::StopWatch callback_time;
+
+        for (usize i = begin; i < end; i++) {
+            callback.callback_fn(&events[i]);
+        }
+
+        callback.timing_p->record(end - begin, callback_time.elapsedNs());
+    }
+}
+
+// Append the execution time statistics of the callbacks
+template <class EventType>
+void CallbackBuffer<EventType>::stats(std::vector<CallbackStats>& out)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto timingStats = [](const CallbackTiming& timing) {
+        return CallbackStats {
+            .type_name = typeid(EventType).name(),
+            .callback_index = 0,
+            .thread_safe = false,
+            .keyed = false,
+            .event_count = timing.event_count.load(std::memory_order_relaxed),
+            .total_ns = timing.total_ns.load(std::memory_order_relaxed),
+            .max_ns = timing.max_ns.load(std::memory_order_relaxed)
+        };
+    };
+
+    for (usize i = 0; i < m_callback_buffer.size(); i++) {
+        CallbackStats callback_stats = 
+            timingStats(*m_callback_buffer[i].timing_p);
+        
+        callback_stats.callback_index = i;
+        callback_stats.thread_safe = 
+            m_callback_buffer[i].mode == CallbackMode::ThreadSafe;
+        
+        out.push_back(callback_stats);
+    }
+
+    if (!m_keyed_callbacks.empty()) {
+        CallbackStats keyed_stats = timingStats(m_keyed_timing);
+        
+        keyed_stats.callback_index = m_callback_buffer.size();
+        keyed_stats.keyed = true;
+        
+        out.push_back(keyed_stats);
+    }
+}
+
 } // namespace cndt::internal
 
 #endif
@@ -1,7 +1,9 @@
 #ifndef CNDT_CALLBACK_REGISTER_H
 #define CNDT_CALLBACK_REGISTER_H
 
+#include "conduit/internal/core/threadPool.h"
 #include "conduit/internal/events/callbackBuffer.h"
+#include "conduit/internal/events/eventRegister.h"
 #include "conduit/internal/events/typeRegister.h"
 
 #include <functional>
@@ -16,7 +18,11 @@ namespace cndt::internal {
 class CallbackRegister {
     // Callback function type
     template <class EventType>
-    using CallbackFn = std::function<void(const EventType*)>;
+    using CallbackFn = EventCallbackFn<EventType>;
+
+    // Event key extractor function type
+    template <class EventType>
+    using KeyFn = EventKeyFn<EventType>;
     
     // Event buffer weak pointer type for readability
     template <class EventType>
@@ -25,13 +31,38 @@ class CallbackRegister {
 public:
     CallbackRegister();
 
-    // Execute all the callbacks in the register for all the event types
-    void executeCallback();
+    // Execute the callbacks of the event types active in the event 
+    // register, if a thread pool is given the thread safe callbacks are 
+    // dispatched on the pool before running the serial callbacks.
+    // The types activated by the callbacks are executed in the same call
+    void executeCallback(
+        EventRegister& event_register,
+        ThreadPool* thread_pool_p = nullptr
+    );
+
+    // Return the execution time statistics of all the callbacks
+    std::vector<CallbackStats> stats();
 
     // Add a callback function to the callback register
     template<class EventType>
     void addCallback(
         EventBufferPtr<EventType> event_buffer_p,
+        CallbackFn<EventType> callback_fn,
+        CallbackMode mode = CallbackMode::Serial
+    );
+
+    // Set the function extracting the dispatch key from the events
+    template<class EventType>
+    void setEventKey(
+        EventBufferPtr<EventType> event_buffer_p,
+        KeyFn<EventType> key_fn
+    );
+
+    // Add a callback called only for the events with the given key
+    template<class EventType>
+    void addKeyedCallback(
+        EventBufferPtr<EventType> event_buffer_p,
+        u64 key,
         CallbackFn<EventType> callback_fn
     );
     
@@ -39,12 +70,19 @@ private:
     // Add the event type to the register if it doesn't already exist
     template<class EventType>
     void addEventType(EventBufferPtr<EventType> event_buffer_p);
+
+    // Return the callback buffer of the given type, null if 
+    // the type doesn't have callbacks
+    CallbackBufferBase* callbackBuffer(u64 type_id);
     
 private:
     std::mutex m_mutex;
     
     // Event buffer vector
     std::vector<std::unique_ptr<CallbackBufferBase>> m_callback_buffers;
+
+    // Thread safe callbacks jobs, reused between updates
+    std::vector<CallbackJob> m_jobs;
 };
 
 /*
@@ -57,7 +95,8 @@ private:
 template<class EventType>
 void CallbackRegister::addCallback(
     CallbackRegister::EventBufferPtr<EventType> event_buffer_p,
-    CallbackRegister::CallbackFn<EventType> callback_fn
+    CallbackRegister::CallbackFn<EventType> callback_fn,
+    CallbackMode mode
 ) {
     // Create the buffer if it doesn't already exist and get the type id
     addEventType<EventType>(std::move(event_buffer_p));
@@ -71,7 +110,46 @@ void CallbackRegister::addCallback(
     );
 
     // Add the callback
-    buffer->addCallback(callback_fn);
+    buffer->addCallback(callback_fn, mode);
+}
+
+// Set the function extracting the dispatch key from the events
+template<class EventType>
+void CallbackRegister::setEventKey(
+    CallbackRegister::EventBufferPtr<EventType> event_buffer_p,
+    CallbackRegister::KeyFn<EventType> key_fn
+) {
+    // Create the buffer if it doesn't already exist and get the type id
+    addEventType<EventType>(std::move(event_buffer_p));
+    auto type_id = EventTypeRegister::getTypeId<EventType>();
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    auto buffer = static_cast<CallbackBuffer<EventType>*>(
+        m_callback_buffers.at(type_id).get()
+    );
+
+    buffer->setKeyFunction(key_fn);
+}
+
+// Add a callback called only for the events with the given key
+template<class EventType>
+void CallbackRegister::addKeyedCallback(
+    CallbackRegister::EventBufferPtr<EventType> event_buffer_p,
+    u64 key,
+    CallbackRegister::CallbackFn<EventType> callback_fn
+) {
+    // Create the buffer if it doesn't already exist and get the type id
+    addEventType<EventType>(std::move(event_buffer_p));
+    auto type_id = EventTypeRegister::getTypeId<EventType>();
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    auto buffer = static_cast<CallbackBuffer<EventType>*>(
+        m_callback_buffers.at(type_id).get()
+    );
+
+    buffer->addKeyedCallback(key, callback_fn);
 }
 
 // Add the event type to the register if it doesn't already exist
@@ -2,10 +2,19 @@
 #define CNDT_EVENT_BUFFER_H
 
 #include "conduit/defines.h"
+#include "conduit/logging.h"
 
+#include "conduit/events/eventStats.h"
+
+#include "conduit/internal/events/eventStaging.h"
+
+#include <algorithm>
 #include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
 #include <vector>
 
 namespace cndt {
@@ -14,6 +23,16 @@ namespace cndt {
 template <class EventType>
 class EventReader;
 
+// Policy used to coalesce the events of the same type sent in an update
+enum class EventCoalesce {
+    // Store every event
+    KeepAll,
+    // Overwrite the last unread event with the new one
+    LastValue,
+    // Merge the new event in the last unread event with a merge function
+    Merge,
+};
+
 } // namespace cndt
 
 namespace cndt::internal {
@@ -21,6 +40,49 @@ namespace cndt::internal {
 // Event buffer starting capacity
 constexpr usize event_buffer_default_size = 10;
 
+/*
+ *
+ *      Event activation list definition
+ *
+ * */
+
+// Type ids of the frozen event buffers that received an event,
+// shared between the event register and its buffers
+class EventActivationList {
+public:
+    EventActivationList() : m_mutex(), m_type_ids(), m_size(0) { }
+
+    // Add an activated event type
+    void push(u64 type_id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_type_ids.push_back(type_id);
+        m_size.store(m_type_ids.size(), std::memory_order_release);
+    }
+
+    // Move the activated event types at the end of the output vector
+    void drain(std::vector<u64>& out)
+    {
+        if (m_size.load(std::memory_order_acquire) == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        out.insert(out.end(), m_type_ids.begin(), m_type_ids.end());
+        
+        m_type_ids.clear();
+        m_size.store(0, std::memory_order_release);
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<u64> m_type_ids;
+
+    // Number of activated types, checked without locking
+    std::atomic<usize> m_size;
+};
+
 /*
  *
  *      Event buffer definition
@@ -31,22 +93,66 @@ constexpr usize event_buffer_default_size = 10;
 class EventBufferBase {
     template <class EventType>
     friend class cndt::EventReader;
+
+    // Activation list shared pointer type for readability
+    using ActivationListPtr = std::shared_ptr<EventActivationList>;
     
 public:
-    EventBufferBase() = default;
+    EventBufferBase() :
+        m_update_count(0),
+        m_active(false),
+        m_type_id(0),
+        m_activation_list_p()
+    { }
     virtual ~EventBufferBase() = default;
 
     // Swap buffers and clear old events
     virtual void update() = 0;
 
+    // Move the concurrently sent events to the current buffer
+    virtual void publish() = 0;
+
+    // Return the buffer throughput and memory usage statistics
+    virtual EventBufferStats stats() = 0;
+
+    // Freeze the buffer if it doesn't store any event and return true,
+    // a frozen buffer is skipped by the register updates until it 
+    // receives an event and adds itself to the activation list
+    virtual bool tryFreeze() = 0;
+
+    // Set the list notified when the frozen buffer receives an event,
+    // must be called before the buffer is shared
+    void setActivationList(u64 type_id, ActivationListPtr activation_list_p)
+    {
+        m_type_id = type_id;
+        m_activation_list_p = std::move(activation_list_p);
+    }
+
 protected:
     // Return true if the current update is odd
     inline bool updateIsOdd() { return m_update_count % 2; };
 
+    // Mark the buffer as active and notify the activation list
+    // if the buffer was frozen
+    void activate()
+    {
+        if (m_active.load(std::memory_order_relaxed))
+            return;
+
+        if (!m_active.exchange(true) && m_activation_list_p)
+            m_activation_list_p->push(m_type_id);
+    }
+
 protected:
     // Update counter, used by the bus to swap between buffers 
     // and by the event readers to keep track of already read events
     std::atomic<u64> m_update_count;
+
+    // False while the buffer is frozen
+    std::atomic<bool> m_active;
+
+    u64 m_type_id;
+    ActivationListPtr m_activation_list_p;
 };
 
 // Event buffer type specific implementation  
@@ -75,19 +181,60 @@ public:
         std::vector<EventType> *m_buffer_p;
     };
 
+    // Locked view over both event vectors
+    struct Snapshot {
+        std::shared_lock<std::shared_mutex> lock;
+
+        // Buffer update count when the snapshot was taken
+        u64 update_count;
+
+        const std::vector<EventType>* old_events_p;
+        const std::vector<EventType>* current_events_p;
+    };
+
+    // Function merging an event in the last stored event
+    using MergeFn = std::function<void(EventType&, const EventType&)>;
+
 public:
     EventBuffer();
 
     // Swap buffers and clear old events
     void update() override;
+
+    // Move the concurrently sent events to the current buffer
+    void publish() override;
+
+    // Return the buffer throughput and memory usage statistics
+    EventBufferStats stats() override;
+
+    // Freeze the buffer if it doesn't store any event
+    bool tryFreeze() override;
     
     // Append an event to the buffer
     void append(const EventType& event);
 
+    // Append all the given events to the buffer with a single lock
+    void appendBatch(std::span<const EventType> events);
+
+    // Stage an event without locking the buffer,
+    // the event is visible to the readers after the next publish
+    void appendConcurrent(const EventType& event);
+
     // Return a read only event buffer object to the current event buffer
     Buffer getCurrentEvents();
     // Return a read only event buffer object to the last frame event buffer
     Buffer getOldEvents();
+
+    // Lock the buffer once and return both the event vectors
+    Snapshot snapshot();
+
+    // Set the policy used to coalesce the appended events,
+    // the merge function is required only by the merge policy
+    void setCoalescing(EventCoalesce policy, MergeFn merge_fn);
+
+private:
+    // Add an event to the events vector applying the coalescing policy
+    void pushEvent(std::vector<EventType>& events, const EventType& event);
     
 private:
     // Event buffer mutex
@@ -97,6 +244,25 @@ private:
     std::vector<EventType> m_events_odd;
     // Store the events during odd updates
     std::vector<EventType> m_events_even;
+
+    // Store the concurrently sent events until the next publish
+    EventStaging<EventType> m_staging;
+
+    // Coalescing policy and merge function
+    EventCoalesce m_coalesce;
+    MergeFn m_merge_fn;
+
+    // Number of current events already seen by a reader,
+    // the events before the mark are never coalesced
+    std::atomic<usize> m_read_mark;
+
+    // Temporary storage for the staged events when coalescing
+    std::vector<EventType> m_staged_events;
+
+    // Events throughput statistics
+    u64 m_last_update_events;
+    u64 m_total_events;
+    u64 m_high_water_mark;
 };
 
 /*
@@ -107,7 +273,13 @@ private:
 
 // Event buffer constructor
 template <class EventType>
-EventBuffer<EventType>::EventBuffer() {
+EventBuffer<EventType>::EventBuffer() :
+    m_coalesce(EventCoalesce::KeepAll),
+    m_read_mark(0),
+    m_last_update_events(0),
+    m_total_events(0),
+    m_high_water_mark(0)
+{
     std::unique_lock<std::shared_mutex> lock(m_mutex);
     
     // Reserve the buffer with the default size
@@ -119,6 +291,13 @@ EventBuffer<EventType>::EventBuffer() {
 template <class EventType>
 void EventBuffer<EventType>::update() {
     std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    // Count the events sent during the ending update
+    m_last_update_events = updateIsOdd() ? 
+        m_events_odd.size() : m_events_even.size();
+    
+    m_total_events += m_last_update_events;
+    m_high_water_mark = std::max(m_high_water_mark, m_last_update_events);
     
     // Clear the buffer for the next update
     if (updateIsOdd()) {
@@ -129,6 +308,7 @@ void EventBuffer<EventType>::update() {
 
     // Increase the event buffers
     m_update_count += 1;
+    m_read_mark = 0;
 }
 
 // Append an event to the buffer
@@ -137,21 +317,104 @@ void EventBuffer<EventType>::append(const EventType& event) {
     std::unique_lock<std::shared_mutex> lock(m_mutex);
     
     if (updateIsOdd()) {
-        m_events_odd.push_back(event);
+        pushEvent(m_events_odd, event);
     } else {
-        m_events_even.push_back(event);
+        pushEvent(m_events_even, event);
     } 
+
+    activate();
+}
+
+// Append all the given events to the buffer with a single lock
+template <class EventType>
+void EventBuffer<EventType>::appendBatch(std::span<const EventType> events) {
+    if (events.empty())
+        return;
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    
+    activate();
+    
+    auto& events_vec = updateIsOdd() ? m_events_odd : m_events_even;
+    
+    if (m_coalesce == EventCoalesce::KeepAll) {
+        events_vec.insert(events_vec.end(), events.begin(), events.end());
+        return;
+    }
+
+    for (auto& event : events) {
+        pushEvent(events_vec, event);
+    }
+}
+
+// Move the concurrently sent events to the current buffer
+template <class EventType>
+void EventBuffer<EventType>::publish() {
+    if (m_staging.empty())
+        return;
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    
+    auto& events_vec = updateIsOdd() ? m_events_odd : m_events_even;
+
+    if (m_coalesce == EventCoalesce::KeepAll) {
+        m_staging.drain(events_vec);
+        return;
+    }
+
+    // Coalesce the staged events like the directly appended ones
+    m_staging.drain(m_staged_events);
+    for (auto& event : m_staged_events) {
+        pushEvent(events_vec, event);
+    }
+
+    m_staged_events.clear();
+}
+
+// Stage an event without locking the buffer
+template <class EventType>
+void EventBuffer<EventType>::appendConcurrent(const EventType& event) {
+    m_staging.push(event);
+
+    // Pairs with the fence in tryFreeze, either the freeze sees the
+    // staged event or the event sees the frozen buffer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    activate();
+}
+
+// Freeze the buffer if it doesn't store any event
+template <class EventType>
+bool EventBuffer<EventType>::tryFreeze() {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    bool has_events = !m_events_odd.empty() || !m_events_even.empty() ||
+        !m_staging.empty();
+    
+    if (has_events)
+        return false;
+
+    m_active.store(false, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // An event staged while freezing could have seen the buffer active,
+    // the buffer is activated again and added back by the register
+    if (!m_staging.empty())
+        activate();
+
+    return true;
 }
 
 // Return a reference to the events in the current update vectors
 template <class EventType>
 typename EventBuffer<EventType>::Buffer 
 EventBuffer<EventType>::getCurrentEvents() {
-    if (updateIsOdd()) {
-        return Buffer(&m_events_odd, m_mutex);
-    } else {
-        return Buffer(&m_events_even, m_mutex);
-    }
+    auto events_p = updateIsOdd() ? &m_events_odd : &m_events_even;
+    Buffer buffer(events_p, m_mutex);
+
+    // The events are locked, the size can't change until the buffer is freed
+    m_read_mark.store(events_p->size(), std::memory_order_relaxed);
+
+    return buffer;
 }
 
 // Return a reference to the events in the last update vectors
@@ -165,6 +428,90 @@ EventBuffer<EventType>::getOldEvents() {
     }
 }
 
+// Lock the buffer once and return both the event vectors
+template <class EventType>
+typename EventBuffer<EventType>::Snapshot EventBuffer<EventType>::snapshot() {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    
+    // The update count can't change while the lock is held
+    u64 update_count = m_update_count;
+    bool odd = update_count % 2;
+
+    m_read_mark.store(
+        odd ? m_events_odd.size() : m_events_even.size(), 
+        std::memory_order_relaxed
+    );
+
+    return Snapshot {
+        .lock = std::move(lock),
+        .update_count = update_count,
+        .old_events_p = odd ? &m_events_even : &m_events_odd,
+        .current_events_p = odd ? &m_events_odd : &m_events_even
+    };
+}
+
+// Return the buffer throughput and memory usage statistics
+template <class EventType>
+EventBufferStats EventBuffer<EventType>::stats()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    usize capacity = m_events_odd.capacity() + m_events_even.capacity();
+
+    return EventBufferStats {
+        .type_name = typeid(EventType).name(),
+        .last_update_events = m_last_update_events,
+        .total_events = m_total_events,
+        .high_water_mark = m_high_water_mark,
+        .capacity = capacity,
+        .bytes = capacity * sizeof(EventType)
+    };
+}
+
+// Set the policy used to coalesce the appended events
+template <class EventType>
+void EventBuffer<EventType>::setCoalescing(
+    EventCoalesce policy, 
+    EventBuffer::MergeFn merge_fn
+) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    if (policy == EventCoalesce::Merge && !merge_fn) {
+        log::core::error(
+            "EventBuffer::setCoalescing -> merge policy without a merge "
+            "function, keeping all the events; Type: {}",
+            typeid(EventType).name()
+        );
+
+        policy = EventCoalesce::KeepAll;
+    }
+
+    m_coalesce = policy;
+    m_merge_fn = merge_fn;
+}
+
+// Add an event to the events vector applying the coalescing policy
+template <class EventType>
+void EventBuffer<EventType>::pushEvent(
+    std::vector<EventType>& events, 
+    const EventType& event
+) {
+    // Only the events not yet seen by a reader can be coalesced
+    bool can_coalesce = m_coalesce != EventCoalesce::KeepAll &&
+        events.size() > m_read_mark.load(std::memory_order_relaxed);
+    
+    if (!can_coalesce) {
+        events.push_back(event);
+        return;
+    }
+
+    if (m_coalesce == EventCoalesce::LastValue) {
+        events.back() = event;
+    } else {
+        m_merge_fn(events.back(), event);
+    }
+}
+
 } // namespace cndt::internal
 
 #endif
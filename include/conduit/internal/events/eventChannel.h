@@ -0,0 +1,267 @@
+#ifndef CNDT_EVENT_CHANNEL_H
+#define CNDT_EVENT_CHANNEL_H
+
+#include "conduit/defines.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace cndt {
+
+// Behavior of a bounded event channel when it's full
+enum class ChannelOverflow {
+    // Overwrite the oldest event in the channel
+    DropOldest,
+    // Discard the event being sent
+    DropNewest,
+    // Wait until an update expire enough events,
+    // must never be used from the thread updating the bus
+    Block,
+};
+
+// Bounded event channel configuration
+struct EventChannelConfig {
+    // Maximum number of events stored in the channel
+    usize capacity = 1024;
+
+    // Overflow policy used when the channel is full
+    ChannelOverflow overflow = ChannelOverflow::DropOldest;
+
+    // Number of bus updates an event stays readable,
+    // the default match the double buffered event buffers
+    u64 lifetime = 2;
+};
+
+} // namespace cndt
+
+namespace cndt::internal {
+
+/*
+ *
+ *      Event channel definition
+ *
+ * */
+
+// Base event channel class
+class EventChannelBase {
+public:
+    EventChannelBase() = default;
+    virtual ~EventChannelBase() = default;
+
+    // Expire the events older than the channel lifetime
+    virtual void update() = 0;
+};
+
+// Bounded event channel backed by a preallocated ring buffer.
+//
+// Every event is identified by a monotonic sequence number,
+// the readers store the next sequence number they have to read
+template <class EventType>
+class EventChannel : public EventChannelBase {
+public:
+    EventChannel(EventChannelConfig config);
+    ~EventChannel() override;
+
+    EventChannel(const EventChannel&) = delete;
+    EventChannel& operator=(const EventChannel&) = delete;
+
+    // Expire the events older than the channel lifetime
+    void update() override;
+
+    // Add an event to the channel applying the overflow policy,
+    // return false if the event was discarded
+    bool send(const EventType& event);
+
+    // Call the given function for all the events starting from the
+    // given sequence number, return the next sequence number to read.
+    // The channel is locked while the function runs
+    template <typename Fn>
+    u64 read(u64 sequence, Fn fn);
+
+    // Return the number of events starting from the given sequence number
+    usize available(u64 sequence);
+
+    // Return the number of events discarded by the overflow policy
+    u64 droppedCount();
+
+    // Return the channel configuration
+    const EventChannelConfig& config() const { return m_config; }
+
+private:
+    // Ring buffer slot storing an event and the update it was sent in
+    struct Slot {
+        alignas(EventType) std::byte data[sizeof(EventType)];
+        u64 update;
+    };
+
+    // Return the event stored in the slot for the given sequence number
+    EventType* eventAt(u64 sequence)
+    {
+        return std::launder(reinterpret_cast<EventType*>(
+            m_slots[sequence % m_config.capacity].data
+        ));
+    }
+
+    // Destroy the oldest event in the channel
+    void popOldest();
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_space_cv;
+
+    EventChannelConfig m_config;
+
+    // Preallocated ring buffer
+    std::unique_ptr<Slot[]> m_slots;
+
+    // Sequence number of the oldest stored event and of the next event
+    u64 m_tail;
+    u64 m_head;
+
+    // Number of bus updates since the channel creation
+    u64 m_update_count;
+
+    // Number of events discarded by the overflow policy
+    u64 m_dropped_count;
+};
+
+/*
+ *
+ *      Event channel implementation
+ *
+ * */
+
+template <class EventType>
+EventChannel<EventType>::EventChannel(EventChannelConfig config) :
+    m_config(config),
+    m_slots(),
+    m_tail(0),
+    m_head(0),
+    m_update_count(0),
+    m_dropped_count(0)
+{
+    m_config.capacity = std::max<usize>(m_config.capacity, 1);
+    m_config.lifetime = std::max<u64>(m_config.lifetime, 1);
+
+    m_slots = std::make_unique<Slot[]>(m_config.capacity);
+}
+
+template <class EventType>
+EventChannel<EventType>::~EventChannel()
+{
+    while (m_tail != m_head) {
+        popOldest();
+    }
+}
+
+// Expire the events older than the channel lifetime
+template <class EventType>
+void EventChannel<EventType>::update()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_update_count += 1;
+
+        while (m_tail != m_head) {
+            u64 event_update = m_slots[m_tail % m_config.capacity].update;
+
+            if (m_update_count - event_update < m_config.lifetime)
+                break;
+
+            popOldest();
+        }
+    }
+
+    // Wake up the blocked senders
+    if (m_config.overflow == ChannelOverflow::Block)
+        m_space_cv.notify_all();
+}
+
+// Add an event to the channel applying the overflow policy
+template <class EventType>
+bool EventChannel<EventType>::send(const EventType& event)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_head - m_tail == m_config.capacity) {
+        switch (m_config.overflow) {
+            case ChannelOverflow::DropOldest: {
+                popOldest();
+                m_dropped_count += 1;
+                break;
+            }
+
+            case ChannelOverflow::DropNewest: {
+                m_dropped_count += 1;
+                return false;
+            }
+
+            case ChannelOverflow::Block: {
+                m_space_cv.wait(lock, [this]() {
+                    return m_head - m_tail < m_config.capacity;
+                });
+                break;
+            }
+        }
+    }
+
+    Slot& slot = m_slots[m_head % m_config.capacity];
+
+    new (slot.data) EventType(event);
+    slot.update = m_update_count;
+
+    m_head += 1;
+
+    return true;
+}
+
+// Call the given function for all the events
+// starting from the given sequence number
+template <class EventType>
+template <typename Fn>
+u64 EventChannel<EventType>::read(u64 sequence, Fn fn)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Skip the events expired or dropped before being read
+    for (u64 i = std::max(sequence, m_tail); i < m_head; i++) {
+        fn(static_cast<const EventType&>(*eventAt(i)));
+    }
+
+    return m_head;
+}
+
+// Return the number of events starting from the given sequence number
+template <class EventType>
+usize EventChannel<EventType>::available(u64 sequence)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_head - std::min(std::max(sequence, m_tail), m_head);
+}
+
+// Return the number of events discarded by the overflow policy
+template <class EventType>
+u64 EventChannel<EventType>::droppedCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_dropped_count;
+}
+
+// Destroy the oldest event in the channel
+template <class EventType>
+void EventChannel<EventType>::popOldest()
+{
+    eventAt(m_tail)->~EventType();
+    m_tail += 1;
+}
+
+} // namespace cndt::internal
+
+#endif
@@ -1,41 +1,122 @@
 #ifndef CNDT_EVENT_REGISTER_H
 #define CNDT_EVENT_REGISTER_H
 
+#include "conduit/logging.h"
+#include "conduit/time.h"
+
+#include "conduit/events/eventStats.h"
+
 #include "conduit/internal/events/eventBuffer.h"
+#include "conduit/internal/events/eventChannel.h"
+#include "conduit/internal/events/timerWheel.h"
 #include "conduit/internal/events/typeRegister.h"
 
+#include <cmath>
 #include <map>
 #include <memory>
 #include <shared_mutex>
+#include <vector>
 
 namespace cndt::internal {
 
-// Store events buffers for the different events types
+// Store events buffers for the different events types.
+//
+// The buffers are stored in a vector indexed by type id, only the
+// buffers storing events are updated. A buffer without events is 
+// frozen and it's added back to the active types by its first event
 class EventRegister {
 public:
-    EventRegister() = default;
+    using TypeId = EventTypeRegister::TypeId;
+
+public:
+    EventRegister();
     
-    // Swap and clear the event buffers
+    // Swap and clear the active event buffers, freeze the buffers
+    // left without events and expire the channels events
     void update();
+
+    // Move the concurrently sent events to the current event buffers
+    void publish();
+
+    // Add the types activated since the last call to the active types
+    // and return the number of active types. Bus thread only
+    usize collectActivated();
+
+    // Return the type ids of the event buffers storing events,
+    // the types activated later are appended. Bus thread only
+    const std::vector<TypeId>& activeTypes() const { return m_active_types; }
+
+    // Return the statistics of all the event buffers
+    std::vector<EventBufferStats> stats();
+
+    // Send the scheduled events expired at the given bus update count
+    // or before the current time
+    void fireTimers(u64 update_count);
+
+    // Schedule an event to be sent after the given delay in seconds
+    template<class EventType>
+    TimerHandle scheduleDelayed(const EventType& event, f64 delay);
+
+    // Schedule an event to be sent during the given bus update
+    template<class EventType>
+    TimerHandle scheduleAt(const EventType& event, u64 update_count);
     
     // Get an event buffer for the specific type
     // if the event doesn't exist create it
     template<class EventType>
     std::weak_ptr<EventBuffer<EventType>> getEventBuffer();
 
+    // Create a bounded event channel for the specific type,
+    // if the channel already exist the configuration is ignored
+    template<class EventType>
+    std::shared_ptr<EventChannel<EventType>> createEventChannel(
+        EventChannelConfig config
+    );
+
+    // Get the bounded event channel for the specific type
+    // if the channel doesn't exist create it with the default configuration
+    template<class EventType>
+    std::shared_ptr<EventChannel<EventType>> getEventChannel();
+
 private:
     // Add the event type to the register if it doesn't already exist
     template<class EventType>
     void addEventType();
+
+    // Return a function appending the event to its buffer
+    template<class EventType>
+    TimerWheel::FireFn sendFunction(const EventType& event);
+
+    // Return the milliseconds since the register creation
+    u64 elapsedMs() const;
     
 private:
     std::shared_mutex m_mutex;
     
-    // Store event buffers
-    using TypeId = EventTypeRegister::TypeId;
+    // Store event buffers, the vector is indexed by type id
+    // so it can contain null buffers
     using EventBufferPtr = std::shared_ptr<EventBufferBase>;
     
-    std::map<TypeId, EventBufferPtr> m_event_buffers;
+    std::vector<EventBufferPtr> m_event_buffers;
+
+    // Type ids of the buffers activated by an event
+    std::shared_ptr<EventActivationList> m_activation_list_p;
+
+    // Type ids of the buffers updated by the register
+    std::vector<TypeId> m_active_types;
+
+    // Store bounded event channels
+    using EventChannelPtr = std::shared_ptr<EventChannelBase>;
+
+    std::map<TypeId, EventChannelPtr> m_event_channels;
+
+    // Scheduled events, the time wheel ticks are milliseconds
+    // since the register creation and the frame wheel ticks are updates
+    std::shared_ptr<TimerWheel> m_time_wheel;
+    std::shared_ptr<TimerWheel> m_frame_wheel;
+
+    time::Clock m_clock;
+    u64 m_start_ms;
 };
 
 /*
@@ -57,10 +138,100 @@ std::weak_ptr<EventBuffer<EventType>> EventRegister::getEventBuffer()
     
     auto type_id = EventTypeRegister::getTypeId<EventType>();
     return std::static_pointer_cast<EventBuffer<EventType>>(
-        m_event_buffers[type_id]
+        m_event_buffers.at(type_id)
     );
 }
 
+// Create a bounded event channel for the specific type
+template<class EventType>
+std::shared_ptr<EventChannel<EventType>> EventRegister::createEventChannel(
+    EventChannelConfig config
+) {
+    auto type_id = EventTypeRegister::getTypeId<EventType>();
+    
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+
+    auto channel_it = m_event_channels.find(type_id);
+    if (channel_it != m_event_channels.end()) {
+        log::core::warn(
+            "EventRegister::createEventChannel -> channel already exist; "
+            "Type: {}",
+            typeid(EventType).name()
+        );
+        
+        return std::static_pointer_cast<EventChannel<EventType>>(
+            channel_it->second
+        );
+    }
+
+    auto channel = std::make_shared<EventChannel<EventType>>(config);
+    m_event_channels[type_id] = channel;
+
+    return channel;
+}
+
+// Get the bounded event channel for the specific type
+// if the channel doesn't exist create it with the default configuration
+template<class EventType>
+std::shared_ptr<EventChannel<EventType>> EventRegister::getEventChannel() 
+{
+    auto type_id = EventTypeRegister::getTypeId<EventType>();
+    
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        
+        auto channel_it = m_event_channels.find(type_id);
+        if (channel_it != m_event_channels.end()) {
+            return std::static_pointer_cast<EventChannel<EventType>>(
+                channel_it->second
+            );
+        }
+    }
+
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+
+    // Another thread could have created the channel in the meantime
+    auto& channel_p = m_event_channels[type_id];
+    if (channel_p == nullptr) {
+        channel_p = std::make_shared<EventChannel<EventType>>(
+            EventChannelConfig()
+        );
+    }
+
+    return std::static_pointer_cast<EventChannel<EventType>>(channel_p);
+}
+
+// Schedule an event to be sent after the given delay in seconds
+template<class EventType>
+TimerHandle EventRegister::scheduleDelayed(const EventType& event, f64 delay)
+{
+    u64 delay_ms = delay > 0.0 ? std::ceil(delay * 1000.0) : 0;
+    u64 expiry = elapsedMs() + delay_ms;
+
+    auto id = m_time_wheel->schedule(expiry, sendFunction(event));
+    return TimerHandle(m_time_wheel, id);
+}
+
+// Schedule an event to be sent during the given bus update
+template<class EventType>
+TimerHandle EventRegister::scheduleAt(
+    const EventType& event, 
+    u64 update_count
+) {
+    auto id = m_frame_wheel->schedule(update_count, sendFunction(event));
+    return TimerHandle(m_frame_wheel, id);
+}
+
+// Return a function appending the event to its buffer
+template<class EventType>
+TimerWheel::FireFn EventRegister::sendFunction(const EventType& event)
+{
+    return [buffer_p = getEventBuffer<EventType>(), event]() {
+        if (auto event_buffer = buffer_p.lock())
+            event_buffer->append(event);
+    };
+}
+
 // Add the event type to the bus if it doesn't already exist
 template<class EventType>
 void EventRegister::addEventType() 
@@ -69,20 +240,29 @@ void EventRegister::addEventType()
     auto type_id = EventTypeRegister::getTypeId<EventType>();
     
     // Create the buffer if it doesn't already exist
-    bool type_exist = false;
     {
         std::shared_lock<std::shared_mutex> lock(m_mutex);
         
-        if (m_event_buffers.find(type_id) != m_event_buffers.end())
-            type_exist = true;
+        if (type_id < m_event_buffers.size() && 
+            m_event_buffers[type_id] != nullptr
+        ) {
+            return;
+        }
     }
 
-    if (!type_exist) {
-        std::lock_guard<std::shared_mutex> lock(m_mutex);
-        
-        auto buffer = std::make_shared<internal::EventBuffer<EventType>>();
+    // Build the buffer before locking the register, 
+    // the new buffer starts frozen until its first event
+    auto buffer = std::make_shared<internal::EventBuffer<EventType>>();
+    buffer->setActivationList(type_id, m_activation_list_p);
+
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+
+    if (m_event_buffers.size() <= type_id)
+        m_event_buffers.resize(type_id + 1);
+
+    // Another thread could have created the buffer in the meantime
+    if (m_event_buffers[type_id] == nullptr)
         m_event_buffers[type_id] = std::move(buffer);
-    }
 }
 
 }; // namespace cndt::internal
@@ -0,0 +1,250 @@
+#ifndef CNDT_EVENT_STAGING_H
+#define CNDT_EVENT_STAGING_H
+
+#include "conduit/defines.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cndt::internal {
+
+// Number of events in the first staging chunk,
+// every following chunk double the size of the previous one
+constexpr usize event_staging_first_chunk = 64;
+
+// Maximum number of chunks in a staging bank
+constexpr usize event_staging_max_chunks = 32;
+
+/*
+ *
+ *      Event staging definition
+ *
+ * */
+
+// Lock free multiple producers single consumer event queue.
+//
+// Producers reserve a slot with an atomic bump index in a list of
+// geometrically growing chunks, the consumer flip between two banks
+// so the producers can keep writing while a bank is drained
+template <class EventType>
+class EventStaging {
+public:
+    EventStaging();
+    ~EventStaging();
+
+    EventStaging(const EventStaging&) = delete;
+    EventStaging& operator=(const EventStaging&) = delete;
+
+    // Copy the event in the staging queue,
+    // can be called concurrently from any thread
+    void push(const EventType& event);
+
+    // Move all the staged events at the end of the output vector
+    // in the order they were reserved, only one thread can drain the queue
+    void drain(std::vector<EventType>& out);
+
+    // Return true if no event was staged since the last drain
+    bool empty() const;
+
+private:
+    // Uninitialized storage for one event
+    struct Slot {
+        alignas(EventType) std::byte data[sizeof(EventType)];
+    };
+
+    // Group of chunks written during the same epoch
+    struct Bank {
+        // Next slot to reserve
+        std::atomic<usize> reserved;
+        // Number of producers currently writing in the bank
+        std::atomic<usize> writers;
+
+        // Lazily allocated slot chunks
+        std::array<std::atomic<Slot*>, event_staging_max_chunks> chunks;
+    };
+
+private:
+    // Return the slot with the given index, allocate the chunk if needed
+    Slot* slotAt(Bank& bank, usize index);
+
+    // Return the event stored in the given slot
+    static EventType* eventAt(Slot* slot_p)
+    {
+        return std::launder(reinterpret_cast<EventType*>(slot_p->data));
+    }
+
+    // Return the chunk storing the slot with the given index
+    // and the slot offset inside the chunk
+    static std::pair<usize, usize> slotLocation(usize index);
+
+    // Move the bank events to the output vector and reset the bank
+    void drainBank(Bank& bank, std::vector<EventType>& out);
+
+private:
+    // Index of the bank used by the producers
+    std::atomic<usize> m_epoch;
+
+    std::array<Bank, 2> m_banks;
+};
+
+/*
+ *
+ *      Event staging implementation
+ *
+ * */
+
+template <class EventType>
+EventStaging<EventType>::EventStaging() :
+    m_epoch(0)
+{
+    for (auto& bank : m_banks) {
+        bank.reserved = 0;
+        bank.writers = 0;
+
+        for (auto& chunk : bank.chunks) {
+            chunk = nullptr;
+        }
+    }
+}
+
+template <class EventType>
+EventStaging<EventType>::~EventStaging()
+{
+    // Destroy the not drained events and release the chunks
+    std::vector<EventType> discarded;
+    drain(discarded);
+    drain(discarded);
+
+    for (auto& bank : m_banks) {
+        for (auto& chunk : bank.chunks) {
+            delete[] chunk.load();
+        }
+    }
+}
+
+// Copy the event in the staging queue
+template <class EventType>
+void EventStaging<EventType>::push(const EventType& event)
+{
+    // Register as a writer of the current bank,
+    // retry if the consumer flipped the bank in the meantime
+    Bank* bank_p = nullptr;
+    while (true) {
+        usize epoch = m_epoch.load();
+        bank_p = &m_banks[epoch];
+
+        bank_p->writers.fetch_add(1);
+        if (m_epoch.load() == epoch)
+            break;
+
+        bank_p->writers.fetch_sub(1);
+    }
+
+    usize index = bank_p->reserved.fetch_add(1, std::memory_order_relaxed);
+    new (slotAt(*bank_p, index)->data) EventType(event);
+
+    bank_p->writers.fetch_sub(1, std::memory_order_release);
+}
+
+// Move all the staged events at the end of the output vector
+template <class EventType>
+void EventStaging<EventType>::drain(std::vector<EventType>& out)
+{
+    // Send the new producers to the other bank
+    usize epoch = m_epoch.load();
+    m_epoch.store(epoch ^ 1);
+
+    // Wait for the producers still writing in the old bank
+    Bank& bank = m_banks[epoch];
+    while (bank.writers.load() != 0) {
+        std::this_thread::yield();
+    }
+
+    drainBank(bank, out);
+}
+
+// Return true if no event was staged since the last drain
+template <class EventType>
+bool EventStaging<EventType>::empty() const
+{
+    return m_banks[0].reserved.load(std::memory_order_relaxed) == 0 &&
+        m_banks[1].reserved.load(std::memory_order_relaxed) == 0;
+}
+
+// Return the chunk storing the slot with the given index
+// and the slot offset inside the chunk
+template <class EventType>
+std::pair<usize, usize> EventStaging<EventType>::slotLocation(usize index)
+{
+    usize chunk = std::bit_width(index / event_staging_first_chunk + 1) - 1;
+    usize chunk_start = event_staging_first_chunk * ((usize(1) << chunk) - 1);
+
+    return { chunk, index - chunk_start };
+}
+
+// Return the slot with the given index, allocate the chunk if needed
+template <class EventType>
+typename EventStaging<EventType>::Slot*
+EventStaging<EventType>::slotAt(Bank& bank, usize index)
+{
+    auto [chunk, offset] = slotLocation(index);
+
+    Slot* chunk_p = bank.chunks[chunk].load(std::memory_order_acquire);
+
+    // Allocate the chunk, if another producer was faster use its chunk
+    if (chunk_p == nullptr) {
+        Slot* new_chunk_p =
+            new Slot[event_staging_first_chunk << chunk];
+
+        if (bank.chunks[chunk].compare_exchange_strong(
+            chunk_p, new_chunk_p, std::memory_order_acq_rel
+        )) {
+            chunk_p = new_chunk_p;
+        } else {
+            delete[] new_chunk_p;
+        }
+    }
+
+    return chunk_p + offset;
+}
+
+// Move the bank events to the output vector and reset the bank,
+// the chunks are kept for the next epochs
+template <class EventType>
+void EventStaging<EventType>::drainBank(
+    Bank& bank,
+    std::vector<EventType>& out
+) {
+    usize count = bank.reserved.load(std::memory_order_relaxed);
+    if (count == 0)
+        return;
+
+    out.reserve(out.size() + count);
+
+    usize index = 0;
+    for (usize chunk = 0; index < count; chunk++) {
+        Slot* chunk_p = bank.chunks[chunk].load(std::memory_order_acquire);
+        usize chunk_size = event_staging_first_chunk << chunk;
+
+        for (usize offset = 0; offset < chunk_size && index < count; offset++) {
+            EventType* event_p = eventAt(chunk_p + offset);
+
+            out.push_back(std::move(*event_p));
+            event_p->~EventType();
+
+            index += 1;
+        }
+    }
+
+    bank.reserved.store(0, std::memory_order_relaxed);
+}
+
+} // namespace cndt::internal
+
+#endif
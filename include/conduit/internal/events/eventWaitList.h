@@ -0,0 +1,183 @@
+#ifndef CNDT_EVENT_WAIT_LIST_H
+#define CNDT_EVENT_WAIT_LIST_H
+
+#include "conduit/defines.h"
+
+#include "conduit/internal/events/eventBuffer.h"
+
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cndt::internal {
+
+template <class EventType>
+class EventWaitList;
+
+} // namespace cndt::internal
+
+namespace cndt {
+
+/*
+ *
+ *      Event awaiter definition
+ *
+ * */
+
+// Suspend a coroutine until the next event of the given type,
+// the coroutine is resumed by the event bus update with a copy of the event
+template <class EventType>
+class EventAwaiter {
+    friend class internal::EventWaitList<EventType>;
+
+public:
+    EventAwaiter(internal::EventWaitList<EventType>* wait_list_p)
+        : m_wait_list_p(wait_list_p)
+    { }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        m_wait_list_p->add(this);
+    }
+
+    EventType await_resume() { return std::move(*m_event); }
+
+private:
+    internal::EventWaitList<EventType>* m_wait_list_p;
+
+    std::coroutine_handle<> m_handle;
+    std::optional<EventType> m_event;
+};
+
+} // namespace cndt
+
+namespace cndt::internal {
+
+/*
+ *
+ *      Event wait list definition
+ *
+ * */
+
+// Base event wait list class
+class EventWaitListBase {
+public:
+    EventWaitListBase() = default;
+    virtual ~EventWaitListBase() = default;
+
+    // Resume the waiting coroutines with the current events
+    virtual void resume() = 0;
+};
+
+// Coroutines waiting for an event type
+template <class EventType>
+class EventWaitList : public EventWaitListBase {
+    // Event buffer weak pointer type for readability
+    using EventBufferPtr = std::weak_ptr<EventBuffer<EventType>>;
+
+public:
+    EventWaitList(EventBufferPtr event_buffer_p)
+        : m_event_buffer_p(std::move(event_buffer_p))
+    { }
+
+    // Destroy the coroutines still waiting
+    ~EventWaitList() override;
+
+    // Add a suspended coroutine awaiter to the list
+    void add(EventAwaiter<EventType>* awaiter_p);
+
+    // Resume the waiting coroutines with the current events, every
+    // event resume the coroutines waiting when it's dispatched so a
+    // coroutine awaiting again in a loop receives all the events
+    void resume() override;
+
+private:
+    std::mutex m_mutex;
+
+    EventBufferPtr m_event_buffer_p;
+
+    // Suspended coroutines awaiters
+    std::vector<EventAwaiter<EventType>*> m_waiters;
+
+    // Awaiters resumed by the current event
+    std::vector<EventAwaiter<EventType>*> m_resuming;
+
+    // Copy of the current events, the buffer can't stay locked
+    // while the coroutines run because they can send events
+    std::vector<EventType> m_events;
+};
+
+/*
+ *
+ *      Event wait list implementation
+ *
+ * */
+
+// Destroy the coroutines still waiting
+template <class EventType>
+EventWaitList<EventType>::~EventWaitList()
+{
+    for (auto awaiter_p : m_waiters) {
+        // The awaiter is stored in the coroutine frame
+        auto handle = awaiter_p->m_handle;
+        handle.destroy();
+    }
+}
+
+// Add a suspended coroutine awaiter to the list
+template <class EventType>
+void EventWaitList<EventType>::add(EventAwaiter<EventType>* awaiter_p)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_waiters.push_back(awaiter_p);
+}
+
+// Resume the waiting coroutines with the current events
+template <class EventType>
+void EventWaitList<EventType>::resume()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_waiters.empty())
+            return;
+    }
+
+    auto event_buffer = m_event_buffer_p.lock();
+    if (!event_buffer)
+        return;
+
+    {
+        auto current_events = event_buffer->getCurrentEvents();
+        m_events.assign(current_events->begin(), current_events->end());
+    }
+
+    for (auto& event : m_events) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_resuming.swap(m_waiters);
+        }
+
+        if (m_resuming.empty())
+            break;
+
+        for (auto awaiter_p : m_resuming) {
+            awaiter_p->m_event = event;
+            awaiter_p->m_handle.resume();
+        }
+
+        m_resuming.clear();
+    }
+
+    m_events.clear();
+}
+
+} // namespace cndt::internal
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef CNDT_TIMER_WHEEL_H
+#define CNDT_TIMER_WHEEL_H
+
+#include "conduit/defines.h"
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cndt::internal {
+
+class EventRegister;
+
+// Number of bits of the tick consumed by every wheel level
+constexpr usize timer_wheel_level_bits = 6;
+
+// Number of slots in every wheel level
+constexpr usize timer_wheel_slots = usize(1) << timer_wheel_level_bits;
+
+// Number of wheel levels, the last level covers 2^36 ticks
+constexpr usize timer_wheel_levels = 6;
+
+/*
+ *
+ *      Timer wheel definition
+ *
+ * */
+
+// Hierarchical timer wheel firing functions at a given tick.
+//
+// Every level splits the ticks in 64 slots, a timer is stored in the
+// lowest level able to contain its expiry and moved to the lower
+// levels when the wheel reaches its slot, so scheduling, cancellation
+// and expiry are constant time amortized. The tick unit is defined by
+// the owner of the wheel
+class TimerWheel {
+public:
+    // Function called when the timer expires
+    using FireFn = std::function<void()>;
+
+    // Timer identifier, the generation invalidates reused slots
+    struct TimerId {
+        u32 index;
+        u32 generation;
+    };
+
+public:
+    TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // Schedule the function at the given tick, if the tick is
+    // already reached the function is called at the next advance
+    TimerId schedule(u64 tick, FireFn fire_fn);
+
+    // Cancel a pending timer, return false if it already fired
+    bool cancel(TimerId id);
+
+    // Return true if the timer has not fired or been cancelled
+    bool pending(TimerId id);
+
+    // Advance the wheel to the given tick and call
+    // the functions of all the expired timers
+    void advance(u64 tick);
+
+    // Return the last tick reached by the wheel
+    u64 currentTick();
+
+    // Return the number of pending timers
+    usize size();
+
+private:
+    // Scheduled timer data
+    struct Timer {
+        FireFn fire_fn;
+        u64 expiry;
+        u32 generation;
+        bool active;
+    };
+
+    // Reference to a timer stored in a wheel slot
+    using Slot = std::vector<TimerId>;
+
+private:
+    // Store the timer in the slot matching its expiry
+    void place(TimerId id);
+
+    // Move the timers of a level slot to the lower levels
+    void cascade(usize level, usize slot);
+
+    // Release the timer and move its function to the fired list
+    void expire(TimerId id);
+
+    // Release a timer slot for reuse
+    void release(u32 index);
+
+    // Return true if the id reference an active timer
+    bool isActive(TimerId id) const;
+
+private:
+    std::mutex m_mutex;
+
+    // Last tick reached by the wheel
+    u64 m_current;
+
+    // Timers storage and free slots indices
+    std::vector<Timer> m_timers;
+    std::vector<u32> m_free_timers;
+    usize m_active_count;
+
+    // Wheel levels slots
+    std::array<std::array<Slot, timer_wheel_slots>, timer_wheel_levels>
+        m_levels;
+
+    // Timers scheduled at an already reached tick
+    Slot m_due;
+
+    // Functions of the expired timers, called outside the lock
+    std::vector<FireFn> m_fired;
+};
+
+} // namespace cndt::internal
+
+namespace cndt {
+
+// Handle to a scheduled event, used to cancel it before it's sent.
+// The handle doesn't keep the event bus alive
+class TimerHandle {
+    friend class internal::EventRegister;
+
+public:
+    // Create an empty handle not referencing any timer
+    TimerHandle() = default;
+
+    // Cancel the scheduled event, return false
+    // if it was already sent or cancelled
+    bool cancel();
+
+    // Return true if the event is still waiting to be sent
+    bool pending() const;
+
+private:
+    TimerHandle(
+        std::weak_ptr<internal::TimerWheel> wheel_p,
+        internal::TimerWheel::TimerId id
+    ) : m_wheel_p(std::move(wheel_p)), m_id(id) { }
+
+private:
+    std::weak_ptr<internal::TimerWheel> m_wheel_p;
+    internal::TimerWheel::TimerId m_id;
+};
+
+} // namespace cndt
+
+#endif
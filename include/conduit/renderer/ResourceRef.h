@@ -3,7 +3,7 @@
 
 #include "conduit/defines.h"
 
-#include <functional>
+#include "conduit/internal/core/inplaceFunction.h"
 
 namespace cndt {
 
@@ -37,11 +37,11 @@ public:
     }
     RenderRef(
         GpuType* ptr,
-        std::function<void(GpuType*)> deffer_delete_f
+        InplaceFunction<void(GpuType*)> deffer_delete_f
     ) : 
         m_ptr(ptr),
         m_ref_count(new Counter),
-        m_deffer_delete_f(deffer_delete_f)
+        m_deffer_delete_f(std::move(deffer_delete_f))
     { 
         *m_ref_count = 1;
     }
@@ -86,7 +86,7 @@ private:
     Counter* m_ref_count;
 
     // Deffer delete function callback
-    std::function<void(GpuType*)> m_deffer_delete_f;
+    InplaceFunction<void(GpuType*)> m_deffer_delete_f;
 };
 
 // Decrease the counter and call the delete callback if it reaches 0
@@ -161,7 +161,7 @@ RenderRef<GpuType>& RenderRef<GpuType>::operator=(
 
     obj.m_ptr = nullptr;
     obj.m_ref_count = nullptr;
-    obj.m_deffer_delete_f = std::function<void(GpuType*)>();
+    obj.m_deffer_delete_f = nullptr;
 
     return *this;
 }
@@ -0,0 +1,119 @@
+#ifndef CNDT_INPUT_STATE_H
+#define CNDT_INPUT_STATE_H
+
+#include "conduit/defines.h"
+
+#include "conduit/events/eventKeyCode.h"
+
+#include "conduit/internal/core/seqLock.h"
+
+#include <bitset>
+
+namespace cndt {
+
+/*
+ *
+ *      Input snapshot definition
+ *
+ * */
+
+// Immutable input state of a single frame
+struct InputSnapshot {
+    // Number of tracked keys and mouse buttons
+    static constexpr usize key_count = keycode::KEY_LAST + 1;
+    static constexpr usize button_count = keycode::MOUSE_BUTTON_LAST + 1;
+
+    // Return true if the key is held down
+    bool isKeyDown(u32 key_code) const;
+    // Return true if the key was pressed during the frame
+    bool isKeyPressed(u32 key_code) const;
+    // Return true if the key was released during the frame
+    bool isKeyReleased(u32 key_code) const;
+
+    // Return true if the mouse button is held down
+    bool isButtonDown(u32 button_code) const;
+    // Return true if the mouse button was pressed during the frame
+    bool isButtonPressed(u32 button_code) const;
+    // Return true if the mouse button was released during the frame
+    bool isButtonReleased(u32 button_code) const;
+
+    // Keys state and the keys pressed and released during the frame
+    std::bitset<key_count> keys_down;
+    std::bitset<key_count> keys_pressed;
+    std::bitset<key_count> keys_released;
+
+    // Mouse buttons state and the buttons pressed
+    // and released during the frame
+    std::bitset<button_count> buttons_down;
+    std::bitset<button_count> buttons_pressed;
+    std::bitset<button_count> buttons_released;
+
+    // Last mouse position
+    f64 mouse_x;
+    f64 mouse_y;
+
+    // Mouse movement and scroll accumulated during the frame
+    f64 mouse_delta_x;
+    f64 mouse_delta_y;
+    f64 scroll_x;
+    f64 scroll_y;
+
+    // Number of frames published before the snapshot
+    u64 frame;
+};
+
+/*
+ *
+ *      Input state definition
+ *
+ * */
+
+// Keyboard and mouse state built from the window input callbacks.
+//
+// The input is accumulated by the window thread and published once
+// per frame as an immutable snapshot, the snapshot can be read from
+// any thread without locking
+class InputState {
+public:
+    InputState();
+    ~InputState() = default;
+
+    InputState(const InputState&) = delete;
+    InputState& operator=(const InputState&) = delete;
+
+    // Return the last published snapshot, thread safe
+    InputSnapshot snapshot() const;
+
+    // Return the number of published frames, thread safe
+    u64 frame() const;
+
+    // Input recording functions, window thread only
+    void keyPress(u32 key_code);
+    void keyRelease(u32 key_code);
+    void buttonPress(u32 button_code);
+    void buttonRelease(u32 button_code);
+    void mouseMove(f64 x_pos, f64 y_pos);
+    void scroll(f64 x_offset, f64 y_offset);
+
+    // Release all the keys and buttons, used when the window
+    // loses the input focus. Window thread only
+    void releaseAll();
+
+    // Publish the input accumulated since the last publish as the
+    // new snapshot and reset the per frame state. Window thread only
+    void publish();
+
+private:
+    // State being accumulated for the next snapshot
+    InputSnapshot m_pending;
+
+    // True after the first mouse position is received
+    bool m_has_mouse_position;
+
+    // Last published snapshot
+    internal::SeqLock<InputSnapshot> m_snapshot;
+};
+
+} // namespace cndt
+
+#endif
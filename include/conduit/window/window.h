@@ -5,6 +5,7 @@
 
 #include "conduit/config/engineConfig.h"
 #include "conduit/renderer/backendEnum.h"
+#include "conduit/window/inputState.h"
 
 #include <vector>
 
@@ -56,6 +57,10 @@ public:
     // Release the cursor and disable raw input if available
     virtual void releaseCursor() = 0;
 
+    // Return the input state snapshot of the last pooled frame,
+    // can be called from any thread
+    virtual InputSnapshot input() = 0;
+
 // Vulkan implementation functions 
 public:
     // Retrieve a vulkan surface
@@ -4,6 +4,8 @@
 #include "conduit/assets/mesh.h"
 #include "conduit/logging.h"
 
+#include "conduit/internal/assets/meshCache.h"
+
 #include <tiny_obj_loader.h>
 
 namespace cndt {
@@ -62,6 +64,119 @@ AssetInfo<Mesh> parseTableEntry<Mesh>(
     );
 }
 
+// Parse an obj file and build the mesh vertices and indices
+static std::unique_ptr<Mesh> importObj(const std::filesystem::path& path)
+{
+    // Open the file with tiny obj
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+    
+    std::string warn;
+    std::string err;
+    
+    bool ret = tinyobj::LoadObj(
+        &attrib,
+        &shapes,
+        &materials,
+        &warn, &err,
+        path.c_str()
+    );
+    
+    // Check for error
+    if (!warn.empty()) {
+        log::core::warn(
+            "Mesh obj file loading: {}",
+            warn
+        );
+    }
+    
+    if (!err.empty()) {
+        throw AssetLoadingError(
+            "Mesh obj loading error: {}",
+            err
+        );
+    }
+    
+    if (!ret) {
+        throw AssetLoadingError(
+            "Mesh obj loading error: {}",
+            "Unknown error"
+        );
+    } 
+
+    if (shapes.size() == 0) {
+        throw AssetLoadingError(
+            "Mesh obj loading error: {}",
+            "No shape in obj file"
+        );
+    }
+
+    // Calculate the number of vertices for preallocation
+    usize shape_count = shapes.size();
+
+    usize vertices_count = 0;
+    for (usize i = 0; i < shape_count; i++) {
+        vertices_count += shapes[i].mesh.indices.size();
+    }
+
+    // Storage buffer
+    std::vector<Vertex3D> vertices;
+    vertices.reserve(vertices_count);
+    std::vector<u32> indices;
+    indices.reserve(vertices_count);
+
+    // Loop over shapes
+    // TODO make this more efficient
+    u32 index = 0;
+    for (usize s = 0; s < shape_count; s++) {
+        // Loop over faces(polygon)
+        for (usize i = 0; i < shapes[s].mesh.indices.size(); i++) {
+            // access to vertex
+            tinyobj::index_t idx = shapes[s].mesh.indices[i];
+
+            Vertex3D vertex = { };
+        
+            vertex.position.x =
+                attrib.vertices[3*size_t(idx.vertex_index)+0];
+            vertex.position.y =
+                attrib.vertices[3*size_t(idx.vertex_index)+1];
+            vertex.position.z =
+                attrib.vertices[3*size_t(idx.vertex_index)+2];
+        
+            // Check if `normal_index` is zero or positive. 
+            // Negative = no normal data
+            if (idx.normal_index >= 0) {
+                vertex.normal.x =
+                    attrib.normals[3*size_t(idx.normal_index)+0];
+                vertex.normal.y =
+                    attrib.normals[3*size_t(idx.normal_index)+1];
+                vertex.normal.z =
+                    attrib.normals[3*size_t(idx.normal_index)+2];
+            }
+        
+            // Check if `texcoord_index` is zero or positive.
+            // Negative = no texcoord data
+            if (idx.texcoord_index >= 0) {
+                vertex.normal.x =
+                    attrib.texcoords[2*size_t(idx.texcoord_index)+0];
+                vertex.normal.y =
+                    attrib.texcoords[2*size_t(idx.texcoord_index)+1];
+            }
+
+            // Push vertex and index to the storage buffer
+            vertices.push_back(vertex);
+            indices.push_back(index);
+
+            // Increment the index
+            index += 1;
+        }
+    }
+
+    // Return the mesh
+    return std::make_unique<Mesh>(std::move(vertices), std::move(indices));
+}
+
 // Load a mesh from the given mesh info 
 template <>
 std::unique_ptr<Mesh> loadAsset<Mesh>(
@@ -79,114 +194,11 @@ std::unique_ptr<Mesh> loadAsset<Mesh>(
             );
         }
 
-        // Open the file with tiny obj
-        tinyobj::attrib_t attrib;
-        std::vector<tinyobj::shape_t> shapes;
-        std::vector<tinyobj::material_t> materials;
-        
-        std::string warn;
-        std::string err;
-        
-        bool ret = tinyobj::LoadObj(
-            &attrib,
-            &shapes,
-            &materials,
-            &warn, &err,
-            path.c_str()
+        // Parse the obj file only if the binary cache is stale
+        return internal::loadCachedMesh(
+            path, 
+            [&path]() { return importObj(path); }
         );
-        
-        // Check for error
-        if (!warn.empty()) {
-            log::core::warn(
-                "Mesh obj file loading: {}",
-                warn
-            );
-        }
-        
-        if (!err.empty()) {
-            throw AssetLoadingError(
-                "Mesh obj loading error: {}",
-                err
-            );
-        }
-        
-        if (!ret) {
-            throw AssetLoadingError(
-                "Mesh obj loading error: {}",
-                "Unknown error"
-            );
-        } 
-
-        if (shapes.size() == 0) {
-            throw AssetLoadingError(
-                "Mesh obj loading error: {}",
-                "No shape in obj file"
-            );
-        }
-
-        // Calculate the number of vertices for preallocation
-        usize shape_count = shapes.size();
-
-        usize vertices_count = 0;
-        for (usize i = 0; i < shape_count; i++) {
-            vertices_count += shapes[i].mesh.indices.size();
-        }
-
-        // Storage buffer
-        std::vector<Vertex3D> vertices;
-        vertices.reserve(vertices_count);
-        std::vector<u32> indices;
-        indices.reserve(vertices_count);
-
-        // Loop over shapes
-        // TODO make this more efficient
-        u32 index = 0;
-        for (usize s = 0; s < shape_count; s++) {
-            // Loop over faces(polygon)
-            for (usize i = 0; i < shapes[s].mesh.indices.size(); i++) {
-                // access to vertex
-                tinyobj::index_t idx = shapes[s].mesh.indices[i];
-
-                Vertex3D vertex = { };
-            
-                vertex.position.x =
-                    attrib.vertices[3*size_t(idx.vertex_index)+0];
-                vertex.position.y =
-                    attrib.vertices[3*size_t(idx.vertex_index)+1];
-                vertex.position.z =
-                    attrib.vertices[3*size_t(idx.vertex_index)+2];
-            
-                // Check if `normal_index` is zero or positive. 
-                // Negative = no normal data
-                if (idx.normal_index >= 0) {
-                    vertex.normal.x =
-                        attrib.normals[3*size_t(idx.normal_index)+0];
-                    vertex.normal.y =
-                        attrib.normals[3*size_t(idx.normal_index)+1];
-                    vertex.normal.z =
-                        attrib.normals[3*size_t(idx.normal_index)+2];
-                }
-            
-                // Check if `texcoord_index` is zero or positive.
-                // Negative = no texcoord data
-                if (idx.texcoord_index >= 0) {
-                    vertex.normal.x =
-                        attrib.texcoords[2*size_t(idx.texcoord_index)+0];
-                    vertex.normal.y =
-                        attrib.texcoords[2*size_t(idx.texcoord_index)+1];
-                }
-
-                // Push vertex and index to the storage buffer
-                vertices.push_back(vertex);
-                indices.push_back(index);
-
-                // Increment the index
-                index += 1;
-            }
-        }
-
-        // Return the mesh
-        return std::make_unique<Mesh>(vertices, indices);
     }
 
     // Unimplemented loading function 
@@ -197,4 +209,12 @@ std::unique_ptr<Mesh> loadAsset<Mesh>(
     return std::make_unique<Mesh>();
 }
 
+// Return the mesh source file path
+template <>
+std::vector<std::filesystem::path> assetSourcePaths<Mesh>(
+    const AssetInfo<Mesh>& info
+) {
+    return { info.path() };
+}
+
 } // namespace cndt
@@ -0,0 +1,352 @@
+#include "conduit/internal/assets/meshCache.h"
+#include "conduit/logging.h"
+
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <glm/common.hpp>
+
+namespace cndt::internal {
+
+// Binary mesh file identifier and format version, the version
+// must be incremented when the layout or the importer output changes
+constexpr u32 mesh_cache_magic = 0x4d444e43; // "CNDM"
+constexpr u32 mesh_cache_version = 1;
+
+// Header layout: magic, version, vertex size, index size,
+// source time, source size, source hash, vertex count, index count,
+// bounds min and bounds max
+constexpr usize mesh_cache_header_size =
+    4 * sizeof(u32) + sizeof(i64) + 4 * sizeof(u64) + 6 * sizeof(f32);
+
+// The vertex and index blobs are copied in and out of the file as is
+static_assert(std::is_trivially_copyable_v<Vertex3D>);
+
+// Append a value bytes to the buffer
+template <typename Type>
+static void writeValue(std::vector<u8>& out, const Type& value)
+{
+    usize offset = out.size();
+
+    out.resize(offset + sizeof(Type));
+    std::memcpy(out.data() + offset, &value, sizeof(Type));
+}
+
+// Read a value from the buffer and advance the offset
+template <typename Type>
+static Type readValue(const std::vector<u8>& data, usize& offset)
+{
+    Type value;
+    std::memcpy(&value, data.data() + offset, sizeof(Type));
+    offset += sizeof(Type);
+
+    return value;
+}
+
+// Return the 64 bit FNV-1a hash of the given bytes
+static u64 hashBytes(const char* data, usize size, u64 hash)
+{
+    for (usize i = 0; i < size; i++) {
+        hash ^= static_cast<u8>(data[i]);
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
+
+// FNV-1a initial hash value
+constexpr u64 hash_offset_basis = 0xcbf29ce484222325;
+
+// Return the hash of the given file content, zero if it can't be read
+static u64 hashFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return 0;
+
+    u64 hash = hash_offset_basis;
+    char buffer[64 * 1024];
+
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        hash = hashBytes(buffer, file.gcount(), hash);
+    }
+
+    return hash;
+}
+
+// Return the cache file of the given source, named after the source path
+static std::filesystem::path cachePath(
+    const std::filesystem::path& source_path
+) {
+    std::error_code error;
+    std::string path_str = std::filesystem::absolute(source_path, error)
+        .lexically_normal().string();
+
+    u64 path_hash = hashBytes(
+        path_str.data(), path_str.size(), hash_offset_basis
+    );
+
+    return std::filesystem::path(mesh_cache_dir) /
+        fmt::format("{:016x}.cmesh", path_hash);
+}
+
+// Identify the content of a source file
+struct SourceKey {
+    i64 time;
+    u64 size;
+};
+
+// Return the source file key, null if the file can't be accessed
+static std::optional<SourceKey> sourceKey(
+    const std::filesystem::path& source_path
+) {
+    std::error_code error;
+
+    auto source_time = std::filesystem::last_write_time(source_path, error);
+    if (error)
+        return std::nullopt;
+
+    u64 source_size = std::filesystem::file_size(source_path, error);
+    if (error)
+        return std::nullopt;
+
+    return SourceKey { 
+        .time = source_time.time_since_epoch().count(), 
+        .size = source_size
+    };
+}
+
+// Load the mesh from the binary cache of the given source file,
+// return null if the cache is missing or the source changed
+static std::unique_ptr<Mesh> readMeshCache(
+    const std::filesystem::path& source_path,
+    const SourceKey& source_key
+) {
+    std::error_code error;
+    std::filesystem::path cache_path = cachePath(source_path);
+
+    std::ifstream file(cache_path, std::ios::binary);
+    if (!file.is_open())
+        return nullptr;
+
+    std::vector<u8> header(mesh_cache_header_size);
+    if (!file.read(reinterpret_cast<char*>(header.data()), header.size()))
+        return nullptr;
+
+    // Check the header, a cache written by another format version
+    // or with a different vertex layout is rebuilt
+    usize offset = 0;
+
+    if (readValue<u32>(header, offset) != mesh_cache_magic ||
+        readValue<u32>(header, offset) != mesh_cache_version ||
+        readValue<u32>(header, offset) != sizeof(Vertex3D) ||
+        readValue<u32>(header, offset) != sizeof(u32)
+    ) {
+        return nullptr;
+    }
+
+    i64 cached_time = readValue<i64>(header, offset);
+    u64 cached_size = readValue<u64>(header, offset);
+    u64 cached_hash = readValue<u64>(header, offset);
+
+    if (cached_size != source_key.size)
+        return nullptr;
+
+    // The source was touched, it's still valid if the content is the same
+    if (cached_time != source_key.time &&
+        cached_hash != hashFile(source_path)
+    ) {
+        return nullptr;
+    }
+
+    u64 vertex_count = readValue<u64>(header, offset);
+    u64 index_count = readValue<u64>(header, offset);
+
+    // Check the blobs size before allocating
+    u64 cache_size = std::filesystem::file_size(cache_path, error);
+    u64 expected_size = mesh_cache_header_size +
+        vertex_count * sizeof(Vertex3D) + index_count * sizeof(u32);
+
+    if (error || cache_size != expected_size)
+        return nullptr;
+
+    // Read the blobs directly in the mesh buffers
+    std::vector<Vertex3D> vertices(vertex_count);
+    std::vector<u32> indices(index_count);
+
+    file.read(
+        reinterpret_cast<char*>(vertices.data()),
+        vertex_count * sizeof(Vertex3D)
+    );
+    file.read(
+        reinterpret_cast<char*>(indices.data()),
+        index_count * sizeof(u32)
+    );
+
+    if (!file)
+        return nullptr;
+
+    log::core::trace(
+        "Mesh cache hit: \"{}\" ({})",
+        source_path.string(),
+        cache_path.string()
+    );
+
+    return std::make_unique<Mesh>(std::move(vertices), std::move(indices));
+}
+
+// Store the mesh imported from the given source file in the binary cache,
+// the source key and hash must be taken before the import so a source 
+// changed during the import doesn't match the cache
+static void writeMeshCache(
+    const std::filesystem::path& source_path,
+    const SourceKey& source_key,
+    u64 source_hash,
+    const Mesh& mesh
+) {
+    std::error_code error;
+    std::filesystem::create_directories(mesh_cache_dir, error);
+
+    if (error) {
+        log::core::warn(
+            "Mesh cache for \"{}\" not written: {}",
+            source_path.string(),
+            error.message()
+        );
+
+        return;
+    }
+
+    usize vertex_count;
+    usize index_count;
+    const Vertex3D* vertices = mesh.getVertexData(vertex_count);
+    const u32* indices = mesh.getIndexData(index_count);
+
+    // Compute the mesh bounds
+    glm::vec3 bounds_min(0.f);
+    glm::vec3 bounds_max(0.f);
+
+    if (vertex_count > 0) {
+        bounds_min = vertices[0].position;
+        bounds_max = vertices[0].position;
+    }
+
+    for (usize i = 0; i < vertex_count; i++) {
+        bounds_min = glm::min(bounds_min, vertices[i].position);
+        bounds_max = glm::max(bounds_max, vertices[i].position);
+    }
+
+    // Write the header
+    std::vector<u8> header;
+    header.reserve(mesh_cache_header_size);
+
+    writeValue(header, mesh_cache_magic);
+    writeValue(header, mesh_cache_version);
+    writeValue(header, u32(sizeof(Vertex3D)));
+    writeValue(header, u32(sizeof(u32)));
+
+    writeValue(header, source_key.time);
+    writeValue(header, source_key.size);
+    writeValue(header, source_hash);
+
+    writeValue(header, u64(vertex_count));
+    writeValue(header, u64(index_count));
+
+    writeValue(header, bounds_min.x);
+    writeValue(header, bounds_min.y);
+    writeValue(header, bounds_min.z);
+    writeValue(header, bounds_max.x);
+    writeValue(header, bounds_max.y);
+    writeValue(header, bounds_max.z);
+
+    // Write to a temporary file and rename it,
+    // a concurrent reader never sees a partial cache
+    std::filesystem::path cache_path = cachePath(source_path);
+    std::filesystem::path temp_path = cache_path;
+    temp_path += fmt::format(
+        ".{}.tmp",
+        std::hash<std::thread::id>{}(std::this_thread::get_id())
+    );
+
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+
+        file.write(
+            reinterpret_cast<const char*>(header.data()),
+            header.size()
+        );
+        file.write(
+            reinterpret_cast<const char*>(vertices),
+            vertex_count * sizeof(Vertex3D)
+        );
+        file.write(
+            reinterpret_cast<const char*>(indices),
+            index_count * sizeof(u32)
+        );
+
+        if (!file) {
+            log::core::warn(
+                "Mesh cache for \"{}\" not written: can't write \"{}\"",
+                source_path.string(),
+                temp_path.string()
+            );
+
+            file.close();
+            std::filesystem::remove(temp_path, error);
+
+            return;
+        }
+    }
+
+    std::filesystem::rename(temp_path, cache_path, error);
+
+    if (error) {
+        log::core::warn(
+            "Mesh cache for \"{}\" not written: {}",
+            source_path.string(),
+            error.message()
+        );
+
+        std::filesystem::remove(temp_path, error);
+
+        return;
+    }
+
+    log::core::debug(
+        "Mesh cache written: \"{}\" ({})",
+        source_path.string(),
+        cache_path.string()
+    );
+}
+
+// Load the mesh from the binary cache or import it on a cache miss
+std::unique_ptr<Mesh> loadCachedMesh(
+    const std::filesystem::path& source_path,
+    const std::function<std::unique_ptr<Mesh>(void)>& import_fn
+) {
+    std::optional<SourceKey> source_key = sourceKey(source_path);
+
+    // Without a valid source the importer reports the error
+    if (!source_key.has_value())
+        return import_fn();
+
+    if (auto mesh = readMeshCache(source_path, source_key.value()))
+        return mesh;
+
+    u64 source_hash = hashFile(source_path);
+    std::unique_ptr<Mesh> mesh = import_fn();
+
+    writeMeshCache(source_path, source_key.value(), source_hash, *mesh);
+
+    return mesh;
+}
+
+} // namespace cndt::internal
@@ -103,7 +103,7 @@ std::unique_ptr<Shader> loadAsset<Shader>(
     // Checking path existence
     std::filesystem::path vk_spv_path = info.pathVkSpv();
     std::filesystem::path vk_glsl_path = info.pathVkGlsl();
-    std::filesystem::path gl_glsl_path = info.pathVkGlsl();
+    std::filesystem::path gl_glsl_path = info.pathGlGlsl();
 
     if(!std::filesystem::exists(vk_spv_path)) {
         throw AssetLoadingError(
@@ -234,4 +234,12 @@ std::unique_ptr<Shader> loadAsset<Shader>(
     );
 }
 
+// Return the shader code files paths of all the backends
+template <>
+std::vector<std::filesystem::path> assetSourcePaths<Shader>(
+    const AssetInfo<Shader>& info
+) {
+    return { info.pathVkSpv(), info.pathVkGlsl(), info.pathGlGlsl() };
+}
+
 } // namespace cndt
@@ -46,4 +46,12 @@ std::unique_ptr<Texture> loadAsset<Texture>(
     return std::make_unique<Texture>();
 }
 
+// Return the texture source image path
+template <>
+std::vector<std::filesystem::path> assetSourcePaths<Texture>(
+    const AssetInfo<Texture>& info
+) {
+    return { info.srcPath() };
+}
+
 } // namespace cndt
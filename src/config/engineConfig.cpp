@@ -25,6 +25,11 @@ void EngineConfig::setDefault()
 
     // Asset manager settings
     assets.user_table_path = std::nullopt;
+    assets.hot_reload = false;
+
+    // Events settings
+    events.record_path = std::nullopt;
+    events.replay_path = std::nullopt;
 }
 
 // Merge the configuration struct with another one,
@@ -55,6 +60,16 @@ void EngineConfig::merge(EngineConfig& config)
     // Assets manager settings
     if (config.assets.user_table_path.has_value())
         assets.user_table_path = config.assets.user_table_path;
+
+    if (config.assets.hot_reload.has_value())
+        assets.hot_reload = config.assets.hot_reload;
+
+    // Events settings
+    if (config.events.record_path.has_value())
+        events.record_path = config.events.record_path;
+
+    if (config.events.replay_path.has_value())
+        events.replay_path = config.events.replay_path;
 }
 
 // Parse a json filed from the settings
@@ -135,6 +150,17 @@ void EngineConfig::parseJson(std::filesystem::path path)
         assets.user_table_path = parseJsonField<std::filesystem::path>(
             asset_data, "user_table_path"
         );        
+        assets.hot_reload = parseJsonField<bool>(asset_data, "hot_reload");
+
+        // Parse events config
+        nlohmann::json events_data = config_data["events"];
+
+        events.record_path = parseJsonField<std::filesystem::path>(
+            events_data, "record_path"
+        );
+        events.replay_path = parseJsonField<std::filesystem::path>(
+            events_data, "replay_path"
+        );
 
     } catch (std::exception &e) {
         throw ConfigParseError(
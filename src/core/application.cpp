@@ -30,11 +30,16 @@ namespace cndt {
 // Base application constructor
 Application::Application() :
     m_run_application(true),
+    m_thread_pool(),
     m_asset_manager(),
     m_event_bus(),
+    m_event_recorder(),
+    m_event_player(),
     m_ecs_world(),
+    m_input_channel(),
     m_window(),
     m_renderer(),
+    m_coroutine_scheduler(),
     m_delete_queue()
 { };
 
@@ -59,9 +64,17 @@ void Application::engineStartup(EngineConfig config)
         );
     }
 
+    // Load the asynchronous assets on the engine workers
+    m_asset_manager.setThreadPool(&m_thread_pool);
+
+    // Reload the assets when their files change
+    if (config.assets.hot_reload.value_or(false))
+        m_asset_manager.enableHotReload();
+
     // Create the glfw window handle
     m_window = std::make_unique<glfw::GlfwWindow>(
-        m_event_bus.getEventWriter()
+        m_event_bus.getEventWriter(),
+        &m_input_channel
     );
     
     m_window->initialize(
@@ -87,6 +100,25 @@ void Application::engineStartup(EngineConfig config)
         &Renderer::shutdown, m_renderer.get()
     ));
     
+    // Run the thread safe callbacks on the engine workers
+    m_event_bus.setThreadPool(&m_thread_pool);
+
+    // Resume the main thread coroutines with the engine scheduler
+    m_coroutine_scheduler.makeCurrent();
+
+    // Store at most one high frequency mouse event per update
+    m_event_bus.setEventCoalescing<MousePositionEvent>(
+        EventCoalesce::LastValue
+    );
+
+    m_event_bus.setEventCoalescing<MouseScrollEvent>(
+        EventCoalesce::Merge,
+        [](MouseScrollEvent& scroll, const MouseScrollEvent& event) {
+            scroll.x_scroll += event.x_scroll;
+            scroll.y_scroll += event.y_scroll;
+        }
+    );
+    
     // Events callbacks setup
     m_event_bus.addCallback<WindowCloseEvent>(
         [&run = m_run_application](const WindowCloseEvent*) { run = false; }
@@ -100,38 +132,69 @@ void Application::engineStartup(EngineConfig config)
 
     // Set up engine key binding
     setupKeyBinding();
+
+    // Replay an event log instead of the window events
+    if (config.events.replay_path.has_value()) {
+        m_event_player = std::make_unique<EventPlayer>(
+            m_event_bus.getEventWriter()
+        );
+        m_event_player->registerEngineEvents();
+
+        if (!m_event_player->open(config.events.replay_path.value()))
+            m_event_player.reset();
+    }
+
+    // Record the engine events
+    if (config.events.record_path.has_value()) {
+        m_event_recorder = std::make_unique<EventRecorder>(m_event_bus);
+        m_event_recorder->recordEngineEvents();
+
+        if (!m_event_recorder->start(config.events.record_path.value()))
+            m_event_recorder.reset();
+    }
 }
 
 // Shutdown the game engine
 void Application::engineShutdown()
 {
+    // Release the suspended coroutines before the engine systems
+    m_coroutine_scheduler.clear();
+
+    if (m_event_recorder)
+        m_event_recorder->stop();
+
     m_delete_queue.callDeleter();
 }
 
 // Set-up the game engine key bindings
 void Application::setupKeyBinding()
 {
-    m_event_bus.addCallback<KeyPressEvent>(
-        [
-        &window = m_window, 
-        &renderer = m_renderer,
-        &asset_manager = m_asset_manager
-        ]
-        (const KeyPressEvent* event) {
-            // Toggle fullscreen
-            if (event->key_code == keycode::KEY_F11) {
-                window->toggleFullscreen();
-            }
-            
-            // Toggle v-sync
-            if (event->key_code == keycode::KEY_F7) {
-                renderer->toggleVsync();
-            }
-
-            // Reload asset
-            if (event->key_code == keycode::KEY_F5) {
-                asset_manager.updateAssets();
-            }
+    // Dispatch the key press events by key code
+    m_event_bus.setEventKey<KeyPressEvent>(
+        [](const KeyPressEvent& event) -> u64 { return event.key_code; }
+    );
+
+    // Toggle fullscreen
+    m_event_bus.addKeyedCallback<KeyPressEvent>(
+        keycode::KEY_F11,
+        [&window = m_window](const KeyPressEvent*) {
+            window->toggleFullscreen();
+        }
+    );
+
+    // Toggle v-sync
+    m_event_bus.addKeyedCallback<KeyPressEvent>(
+        keycode::KEY_F7,
+        [&renderer = m_renderer](const KeyPressEvent*) {
+            renderer->toggleVsync();
+        }
+    );
+
+    // Reload asset
+    m_event_bus.addKeyedCallback<KeyPressEvent>(
+        keycode::KEY_F5,
+        [&asset_manager = m_asset_manager](const KeyPressEvent*) {
+            asset_manager.updateAssets();
         }
     );
 }
@@ -147,17 +210,40 @@ void Application::mainLoop()
 {
     time::StopWatch frame_time;
 
+    // Send the input events produced by the window to the bus
+    EventWriter input_writer = m_event_bus.getEventWriter();
+
     while (m_run_application) {
         // Run the user define application update function
         update(frame_time.delta());
+        m_ecs_world.update();
 
         // Draw a frame
         RenderPacket packet = m_renderer->getRenderPacket();
         m_renderer->executePacket(packet);
 
-        // Pool the window event and update the event buffer
-        m_window->poolEvents();
+        // Pool the window event or replay the recorded ones
+        // and update the event buffer
+        if (m_event_player) {
+            m_event_player->update();
+            
+            if (m_event_player->finished())
+                m_run_application = false;
+        } else {
+            m_window->poolEvents();
+            m_input_channel.drain(input_writer);
+        }
+
         m_event_bus.update();
+
+        // Reload the assets changed on disk, if hot reload is enabled
+        m_asset_manager.updateChangedAssets();
+
+        if (m_event_recorder)
+            m_event_recorder->update();
+
+        // Resume the coroutines waiting for the next frame
+        m_coroutine_scheduler.update();
     }
 }
 
@@ -0,0 +1,156 @@
+#include "conduit/coroutine.h"
+#include "conduit/logging.h"
+
+#include <cmath>
+#include <exception>
+
+namespace cndt {
+
+// Scheduler used by the awaitables on the current thread
+static thread_local CoroutineScheduler* current_scheduler_p = nullptr;
+
+/*
+ *
+ *      Task implementation
+ *
+ * */
+
+// Log the exceptions escaping the coroutine body
+void Task::promise_type::unhandled_exception()
+{
+    try {
+        throw;
+    } catch (const std::exception& e) {
+        log::core::error("Task -> unhandled exception: {}", e.what());
+    } catch (...) {
+        log::core::error("Task -> unhandled unknown exception");
+    }
+}
+
+/*
+ *
+ *      Coroutine scheduler implementation
+ *
+ * */
+
+CoroutineScheduler::CoroutineScheduler() :
+    m_frame_waits(),
+    m_timed_waits(),
+    m_wait_order(0),
+    m_resuming(),
+    m_clock()
+{ }
+
+CoroutineScheduler::~CoroutineScheduler()
+{
+    clear();
+
+    if (current_scheduler_p == this)
+        current_scheduler_p = nullptr;
+}
+
+// Resume the coroutines waiting for the next frame
+// and the ones whose wait time expired
+void CoroutineScheduler::update()
+{
+    // Collect the coroutines before resuming them, the waits
+    // added while resuming are handled at the next update
+    m_resuming.clear();
+    m_resuming.swap(m_frame_waits);
+
+    u64 now_ms = m_clock.nowMs();
+    while (!m_timed_waits.empty() && m_timed_waits.top().wake_ms <= now_ms) {
+        m_resuming.push_back(m_timed_waits.top().handle);
+        m_timed_waits.pop();
+    }
+
+    for (auto handle : m_resuming) {
+        handle.resume();
+    }
+
+    m_resuming.clear();
+}
+
+// Destroy all the suspended coroutines without resuming them
+void CoroutineScheduler::clear()
+{
+    for (auto handle : m_frame_waits) {
+        handle.destroy();
+    }
+    m_frame_waits.clear();
+
+    while (!m_timed_waits.empty()) {
+        m_timed_waits.top().handle.destroy();
+        m_timed_waits.pop();
+    }
+}
+
+// Make the scheduler the one used by nextFrame and seconds
+void CoroutineScheduler::makeCurrent()
+{
+    current_scheduler_p = this;
+}
+
+// Return the scheduler used by the calling thread
+CoroutineScheduler* CoroutineScheduler::current()
+{
+    return current_scheduler_p;
+}
+
+// Resume the coroutine at the next update
+void CoroutineScheduler::waitFrame(CoroutineScheduler::Handle handle)
+{
+    m_frame_waits.push_back(handle);
+}
+
+// Resume the coroutine at the first update after the given delay
+void CoroutineScheduler::waitSeconds(
+    f64 delay,
+    CoroutineScheduler::Handle handle
+) {
+    u64 delay_ms = delay > 0.0 ? std::ceil(delay * 1000.0) : 0;
+
+    m_timed_waits.push(TimedWait {
+        .wake_ms = m_clock.nowMs() + delay_ms,
+        .order = m_wait_order++,
+        .handle = handle
+    });
+}
+
+// Return the number of suspended coroutines
+usize CoroutineScheduler::size() const
+{
+    return m_frame_waits.size() + m_timed_waits.size();
+}
+
+/*
+ *
+ *      Scheduler awaitables implementation
+ *
+ * */
+
+// Suspend the coroutine until the next scheduler update
+bool FrameAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    if (current_scheduler_p == nullptr) {
+        log::core::error("nextFrame -> no coroutine scheduler on the thread");
+        return false;
+    }
+
+    current_scheduler_p->waitFrame(handle);
+    return true;
+}
+
+// Suspend the coroutine until the given time has passed
+bool TimeAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    if (current_scheduler_p == nullptr) {
+        log::core::error("seconds -> no coroutine scheduler on the thread");
+        return false;
+    }
+
+    current_scheduler_p->waitSeconds(m_delay, handle);
+    return true;
+}
+
+} // namespace cndt
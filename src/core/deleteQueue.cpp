@@ -1,10 +1,12 @@
 #include "conduit/internal/core/deleteQueue.h"
 
+#include <utility>
+
 namespace cndt {
 
-void DeleteQueue::addDeleter(std::function<void(void)> deleter_fun) 
+void DeleteQueue::addDeleter(DeleteQueue::DeleterFn deleter_fun) 
 {
-    m_deleters.push_back(deleter_fun);
+    m_deleters.push_back(std::move(deleter_fun));
 }
 
 void DeleteQueue::callDeleter()
@@ -0,0 +1,188 @@
+#include "conduit/internal/core/fileWatcher.h"
+#include "conduit/logging.h"
+
+#include "buildConfig.h"
+
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#ifdef CNDT_PLATFORM_LINUX
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace cndt {
+
+FileWatcher::FileWatcher(std::chrono::milliseconds debounce) :
+    m_debounce(debounce),
+    m_files(),
+    m_polled_files(),
+    m_last_scan(SteadyClock::now()),
+    m_pending(),
+    m_inotify_fd(-1),
+    m_dir_watches(),
+    m_watched_dirs()
+{
+#ifdef CNDT_PLATFORM_LINUX
+    m_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (m_inotify_fd < 0) {
+        log::core::warn(
+            "FileWatcher -> inotify unavailable ({}), scanning the files",
+            std::strerror(errno)
+        );
+    }
+#endif
+}
+
+FileWatcher::~FileWatcher()
+{
+#ifdef CNDT_PLATFORM_LINUX
+    if (m_inotify_fd >= 0)
+        close(m_inotify_fd);
+#endif
+}
+
+// Start watching the given file
+void FileWatcher::watch(const std::filesystem::path& file_path)
+{
+    std::filesystem::path normal_path = normalize(file_path);
+
+    if (!m_files.insert(normal_path.string()).second)
+        return;
+
+#ifdef CNDT_PLATFORM_LINUX
+    // Watch the parent directory, editors often save
+    // by replacing the file so the file itself can't be watched
+    std::filesystem::path dir_path = normal_path.parent_path();
+
+    if (m_watched_dirs.contains(dir_path.string()))
+        return;
+
+    if (m_inotify_fd >= 0) {
+        i32 watch_descriptor = inotify_add_watch(
+            m_inotify_fd,
+            dir_path.c_str(),
+            IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE
+        );
+
+        if (watch_descriptor >= 0) {
+            m_dir_watches[watch_descriptor] = dir_path;
+            m_watched_dirs.insert(dir_path.string());
+
+            return;
+        }
+
+        log::core::warn(
+            "FileWatcher -> can't watch \"{}\" ({}), scanning the file",
+            dir_path.string(),
+            std::strerror(errno)
+        );
+    }
+#endif
+
+    // Without notifications compare the file modification time
+    std::error_code error;
+    auto write_time = std::filesystem::last_write_time(normal_path, error);
+
+    m_polled_files[normal_path.string()] = error ?
+        std::filesystem::file_time_type::min() : write_time;
+}
+
+// Return the watched files whose changes settled
+std::vector<std::filesystem::path> FileWatcher::poll()
+{
+    readChanges();
+
+    std::vector<std::filesystem::path> changed_files;
+    auto now = SteadyClock::now();
+
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (now - it->second >= m_debounce) {
+            changed_files.emplace_back(it->first);
+            it = m_pending.erase(it);
+        } else {
+            it++;
+        }
+    }
+
+    return changed_files;
+}
+
+// Return the absolute normal path used to identify the given file
+std::filesystem::path FileWatcher::normalize(
+    const std::filesystem::path& file_path
+) {
+    std::error_code error;
+    std::filesystem::path absolute_path =
+        std::filesystem::absolute(file_path, error);
+
+    if (error)
+        return file_path.lexically_normal();
+
+    return absolute_path.lexically_normal();
+}
+
+// Read the pending change notifications and mark the changed files
+void FileWatcher::readChanges()
+{
+#ifdef CNDT_PLATFORM_LINUX
+    if (m_inotify_fd >= 0) {
+        alignas(inotify_event) char buffer[4096];
+
+        // The descriptor is non blocking, read until it's empty
+        ssize_t length;
+        while ((length = read(m_inotify_fd, buffer, sizeof(buffer))) > 0) {
+            for (ssize_t offset = 0; offset < length;) {
+                auto* event = reinterpret_cast<inotify_event*>(
+                    buffer + offset
+                );
+                offset += sizeof(inotify_event) + event->len;
+
+                // Some notifications were lost, reload every file
+                if (event->mask & IN_Q_OVERFLOW) {
+                    for (auto& file : m_files) { markChanged(file); }
+                    continue;
+                }
+
+                auto dir_it = m_dir_watches.find(event->wd);
+                if (event->len == 0 || dir_it == m_dir_watches.end())
+                    continue;
+
+                // Ignore the other files in the watched directories
+                std::filesystem::path file_path =
+                    dir_it->second / event->name;
+
+                if (m_files.contains(file_path.string()))
+                    markChanged(file_path);
+            }
+        }
+    }
+#endif
+
+    // Scan the files without notifications
+    auto now = SteadyClock::now();
+    if (m_polled_files.empty() || now - m_last_scan < m_debounce)
+        return;
+
+    m_last_scan = now;
+
+    for (auto& [file, write_time] : m_polled_files) {
+        std::error_code error;
+        auto new_write_time = std::filesystem::last_write_time(file, error);
+
+        if (!error && new_write_time != write_time) {
+            write_time = new_write_time;
+            markChanged(file);
+        }
+    }
+}
+
+// Mark the given file as changed now
+void FileWatcher::markChanged(const std::filesystem::path& file_path)
+{
+    m_pending[file_path.string()] = SteadyClock::now();
+}
+
+} // namespace cndt
@@ -0,0 +1,140 @@
+#include "conduit/internal/core/threadPool.h"
+#include "conduit/logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace cndt {
+
+ThreadPool::ThreadPool(usize thread_count) :
+    m_stop(false)
+{
+    if (thread_count == 0) {
+        usize hardware_threads = std::thread::hardware_concurrency();
+        thread_count = std::max<usize>(hardware_threads, 2) - 1;
+    }
+
+    m_workers.reserve(thread_count);
+    for (usize i = 0; i < thread_count; i++) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_task_cv.notify_all();
+
+    // The workers complete the queued tasks before exiting
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+// Add a task to the pool queue
+void ThreadPool::submit(std::function<void(void)> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_task_cv.notify_one();
+}
+
+// Call the given function for every index in the range [0, count)
+void ThreadPool::parallelFor(
+    usize count, 
+    const std::function<void(usize)>& fn
+) {
+    if (count == 0)
+        return;
+
+    // Shared state, the helpers can outlive the call 
+    // if they are scheduled after all the indices were executed
+    struct State {
+        std::atomic<usize> next_index = 0;
+        std::atomic<usize> done_count = 0;
+
+        std::mutex mutex;
+        std::condition_variable done_cv;
+    };
+    auto state_p = std::make_shared<State>();
+
+    // Execute indices until the range is exhausted
+    auto run = [state_p, count, &fn]() {
+        usize executed = 0;
+
+        for (
+            usize i = state_p->next_index++; 
+            i < count; 
+            i = state_p->next_index++
+        ) {
+            // An exception must not prevent the range completion
+            try {
+                fn(i);
+            } catch (const std::exception& e) {
+                log::core::error(
+                    "ThreadPool::parallelFor -> task exception: {}", 
+                    e.what()
+                );
+            }
+            
+            executed += 1;
+        }
+
+        if (executed == 0)
+            return;
+
+        if (state_p->done_count.fetch_add(executed) + executed == count) {
+            std::lock_guard<std::mutex> lock(state_p->mutex);
+            state_p->done_cv.notify_all();
+        }
+    };
+
+    usize helper_count = std::min(m_workers.size(), count - 1);
+    for (usize i = 0; i < helper_count; i++) {
+        submit(run);
+    }
+
+    run();
+
+    std::unique_lock<std::mutex> lock(state_p->mutex);
+    state_p->done_cv.wait(lock, [&]() { 
+        return state_p->done_count == count; 
+    });
+}
+
+// Worker threads main loop
+void ThreadPool::workerLoop()
+{
+    while (true) {
+        std::function<void(void)> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_task_cv.wait(lock, [this]() { 
+                return m_stop || !m_tasks.empty(); 
+            });
+
+            if (m_stop && m_tasks.empty())
+                return;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            log::core::error(
+                "ThreadPool::workerLoop -> task exception: {}", 
+                e.what()
+            );
+        }
+    }
+}
+
+} // namespace cndt
@@ -6,7 +6,7 @@ namespace cndt {
 // Append a delete entity commands
 void ECSCmdBuffer::deleteEntity(Entity entity)
 {
-    m_commands.emplace_back(
+    pushCommand(
         [=](World* world) {
             world->deleteEntity(entity);
         }
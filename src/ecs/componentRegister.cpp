@@ -10,4 +10,42 @@ void ComponentRegister::detachAllComponets(Entity entity)
     }   
 }
 
+// Move all the components of the other register to this register
+// applying the remap, the other register is left empty
+void ComponentRegister::merge(ComponentRegister& other, const EntityRemap& remap)
+{
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+    std::lock_guard<std::shared_mutex> other_lock(other.m_mutex);
+
+    for (auto& [type_id, other_buf] : other.m_component_buffers) {
+        auto buf_it = m_component_buffers.find(type_id);
+
+        // No query can reference a buffer missing from this register, 
+        // so the other buffer can be moved without copying the components
+        if (buf_it == m_component_buffers.end()) {
+            other_buf->remapEntities(remap);
+            m_component_buffers[type_id] = std::move(other_buf);
+        } else {
+            buf_it->second->mergeBuffer(*other_buf, remap);
+        }
+    }
+
+    other.m_component_buffers.clear();
+}
+
+// Return the memory usage statistics of all the component buffers
+std::vector<ComponentBufferStats> ComponentRegister::stats()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    std::vector<ComponentBufferStats> buffers_stats;
+    buffers_stats.reserve(m_component_buffers.size());
+
+    for (auto& buf : m_component_buffers) {
+        buffers_stats.push_back(buf.second->stats());
+    }
+
+    return buffers_stats;
+}
+
 } // namespace cndt::internal
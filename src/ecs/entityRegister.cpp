@@ -32,6 +32,15 @@ Entity EntityRegister::newEntity()
     }
 }
 
+// Create the given number of entities with contiguous ids
+EntityRange EntityRegister::newEntityRange(usize count)
+{
+    EntityRange range(m_last_entity_id, count);
+    m_last_entity_id += count;
+
+    return range;
+}
+
 void EntityRegister::deleteEntity(Entity entity) 
 {
     // Check if the entity was already freed
@@ -58,5 +67,29 @@ void EntityRegister::deleteEntity(Entity entity)
     }
 }
 
+// Move the other register entities to a new id range 
+// and reset the other register, return the id remap
+EntityRemap EntityRegister::merge(EntityRegister& other)
+{
+    // Reserve a contiguous id range above the last assigned entity
+    EntityRemap remap(m_last_entity_id, other.m_last_entity_id);
+    m_last_entity_id += other.m_last_entity_id;
+
+    // The free ids of the other register are free in the new range too
+    for (auto entity : other.m_free_entity_list) {
+        m_free_entity_list.push_back(remap.remap(entity));
+    }
+
+    other.m_last_entity_id = 0;
+    other.m_free_entity_list.clear();
+
+    return remap;
+}
+
+usize EntityRegister::entityCount() const
+{
+    return m_last_entity_id - m_free_entity_list.size();
+}
+
 }
 
@@ -0,0 +1,28 @@
+#include "conduit/internal/ecs/queryRegister.h"
+
+namespace cndt::internal {
+
+// Return the rebuild statistics of all the cached query storages
+std::vector<QueryStorageStats> QueryRegister::stats()
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    std::vector<QueryStorageStats> storages_stats;
+    storages_stats.reserve(m_query_storages.size());
+
+    for (auto& storage : m_query_storages) {
+        storages_stats.push_back(storage.second->stats());
+    }
+
+    return storages_stats;
+}
+
+// Remove all the cached query storages
+void QueryRegister::clear()
+{
+    std::lock_guard<std::shared_mutex> lock(m_mutex);
+
+    m_query_storages.clear();
+}
+
+} // namespace cndt::internal
@@ -0,0 +1,507 @@
+#include "conduit/ecs/spatialIndex.h"
+
+#include "conduit/components/bounds.h"
+#include "conduit/components/transform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+
+namespace cndt {
+
+// Invalid item index in the entity map
+constexpr u32 invalid_item = UINT32_MAX;
+
+// Number of bits used to store each cell coordinate in a cell key
+constexpr u32 cell_key_bits = 21;
+constexpr i64 cell_key_offset = i64(1) << (cell_key_bits - 1);
+constexpr u64 cell_key_mask = (u64(1) << cell_key_bits) - 1;
+
+SpatialIndex::SpatialIndex(f32 cell_size) :
+    m_cell_size(cell_size),
+    m_inv_cell_size(1.0f / cell_size),
+    m_max_half_extent(0.0f),
+    m_stamp(0),
+    m_items(),
+    m_entity_items(),
+    m_cells()
+{ }
+
+// Synchronize the index with the Transform and Bounds components
+void SpatialIndex::update(World& world)
+{
+    m_stamp += 1;
+
+    // Move the entities whose position changed cell
+    {
+        auto query = world.getQuery<Transform>();
+
+        for (auto element : query) {
+            placeItem(element.entity(), element.get<Transform>().position());
+        }
+    }
+
+    // Update the entities bounds and the largest half extent
+    f32 max_half_extent = 0.0f;
+    {
+        auto query = world.getQuery<Transform, Bounds>();
+
+        for (auto element : query) {
+            Item& item = m_items[m_entity_items[element.entity().id()]];
+            item.half_extents = glm::abs(
+                element.get<Bounds>().getHalfExtents()
+            );
+
+            max_half_extent = std::max({
+                max_half_extent,
+                item.half_extents.x,
+                item.half_extents.y,
+                item.half_extents.z
+            });
+        }
+    }
+    m_max_half_extent = max_half_extent;
+
+    // Remove the entities that lost their transform
+    for (usize i = m_items.size(); i != 0; i--) {
+        if (m_items[i - 1].stamp != m_stamp)
+            removeItem(i - 1);
+    }
+}
+
+// Remove all the entities from the index
+void SpatialIndex::clear()
+{
+    m_items.clear();
+    m_entity_items.clear();
+    m_cells.clear();
+
+    m_max_half_extent = 0.0f;
+}
+
+// Store in the output vector all the entities
+// overlapping the sphere with the given center and radius
+void SpatialIndex::queryRadius(
+    glm::vec3 center,
+    f32 radius,
+    std::vector<Entity>& out
+) const {
+    glm::vec3 reach(radius + m_max_half_extent);
+    f32 radius_sq = radius * radius;
+
+    forEachInCells(
+        cellOf(center - reach), cellOf(center + reach),
+        [&](const Item& item) {
+            // Distance from the center to the closest point of the item box
+            glm::vec3 closest = glm::clamp(
+                center,
+                item.position - item.half_extents,
+                item.position + item.half_extents
+            );
+            glm::vec3 delta = closest - center;
+
+            if (glm::dot(delta, delta) <= radius_sq)
+                out.push_back(item.entity);
+        }
+    );
+}
+
+// Store in the output vector all the entities
+// overlapping the given axis aligned box
+void SpatialIndex::queryAabb(
+    glm::vec3 min,
+    glm::vec3 max,
+    std::vector<Entity>& out
+) const {
+    glm::vec3 reach(m_max_half_extent);
+
+    forEachInCells(
+        cellOf(min - reach), cellOf(max + reach),
+        [&](const Item& item) {
+            glm::vec3 item_min = item.position - item.half_extents;
+            glm::vec3 item_max = item.position + item.half_extents;
+
+            bool overlap =
+                item_min.x <= max.x && item_max.x >= min.x &&
+                item_min.y <= max.y && item_max.y >= min.y &&
+                item_min.z <= max.z && item_max.z >= min.z;
+
+            if (overlap)
+                out.push_back(item.entity);
+        }
+    );
+}
+
+// Return the closest entity hit by the ray
+std::optional<SpatialIndex::RayHit> SpatialIndex::raycast(
+    glm::vec3 origin,
+    glm::vec3 direction,
+    f32 max_distance
+) const {
+    f32 direction_len = glm::length(direction);
+    if (m_items.empty() || direction_len == 0.0f)
+        return std::nullopt;
+
+    glm::vec3 dir = direction / direction_len;
+    constexpr f32 infinity = std::numeric_limits<f32>::infinity();
+
+    // Ray box slab intersection, return the entry distance
+    auto intersect = [&](const Item& item) -> f32 {
+        glm::vec3 box_min = item.position - item.half_extents;
+        glm::vec3 box_max = item.position + item.half_extents;
+
+        f32 t_min = 0.0f;
+        f32 t_max = max_distance;
+
+        for (i32 axis = 0; axis < 3; axis++) {
+            if (dir[axis] == 0.0f) {
+                if (origin[axis] < box_min[axis] ||
+                    origin[axis] > box_max[axis])
+                    return infinity;
+
+                continue;
+            }
+
+            f32 inv_dir = 1.0f / dir[axis];
+            f32 t1 = (box_min[axis] - origin[axis]) * inv_dir;
+            f32 t2 = (box_max[axis] - origin[axis]) * inv_dir;
+
+            t_min = std::max(t_min, std::min(t1, t2));
+            t_max = std::min(t_max, std::max(t1, t2));
+        }
+
+        return (t_min <= t_max) ? t_min : infinity;
+    };
+
+    // Number of neighbor cells an entity box can overlap
+    i32 margin = static_cast<i32>(
+        std::ceil(m_max_half_extent * m_inv_cell_size)
+    );
+    std::unordered_set<CellKey> tested_cells;
+
+    // Walk the grid cells crossed by the ray (Amanatides - Woo traversal)
+    Cell cell = cellOf(origin);
+    i32 step[3];
+    f32 t_next[3];
+    f32 t_delta[3];
+
+    for (i32 axis = 0; axis < 3; axis++) {
+        i32 cell_coord = (axis == 0) ? cell.x : (axis == 1) ? cell.y : cell.z;
+
+        if (dir[axis] > 0.0f) {
+            step[axis] = 1;
+            t_next[axis] =
+                ((cell_coord + 1) * m_cell_size - origin[axis]) / dir[axis];
+            t_delta[axis] = m_cell_size / dir[axis];
+        } else if (dir[axis] < 0.0f) {
+            step[axis] = -1;
+            t_next[axis] =
+                (cell_coord * m_cell_size - origin[axis]) / dir[axis];
+            t_delta[axis] = -m_cell_size / dir[axis];
+        } else {
+            step[axis] = 0;
+            t_next[axis] = infinity;
+            t_delta[axis] = infinity;
+        }
+    }
+
+    std::optional<RayHit> best_hit;
+    f32 t_entry = 0.0f;
+
+    while (t_entry <= max_distance) {
+        // Every box hit closer than the current cell was already tested
+        if (best_hit.has_value() && t_entry > best_hit->distance)
+            break;
+
+        for (i32 x = cell.x - margin; x <= cell.x + margin; x++) {
+        for (i32 y = cell.y - margin; y <= cell.y + margin; y++) {
+        for (i32 z = cell.z - margin; z <= cell.z + margin; z++) {
+            CellKey key = cellKey({x, y, z});
+
+            if (margin != 0 && !tested_cells.insert(key).second)
+                continue;
+
+            auto cell_it = m_cells.find(key);
+            if (cell_it == m_cells.end())
+                continue;
+
+            for (u32 item_index : cell_it->second) {
+                const Item& item = m_items[item_index];
+                f32 t_hit = intersect(item);
+
+                if (t_hit != infinity &&
+                    (!best_hit.has_value() || t_hit < best_hit->distance)
+                ) {
+                    best_hit = RayHit { item.entity, t_hit };
+                }
+            }
+        }
+        }
+        }
+
+        // Step to the next cell along the axis with the closest boundary
+        i32 axis = 0;
+        if (t_next[1] < t_next[axis]) axis = 1;
+        if (t_next[2] < t_next[axis]) axis = 2;
+
+        if (t_next[axis] == infinity)
+            break;
+
+        t_entry = t_next[axis];
+        t_next[axis] += t_delta[axis];
+
+        if (axis == 0) cell.x += step[0];
+        else if (axis == 1) cell.y += step[1];
+        else cell.z += step[2];
+    }
+
+    return best_hit;
+}
+
+// Store in the output vector the k entities closest to the given point
+void SpatialIndex::queryNearest(
+    glm::vec3 point,
+    usize k,
+    std::vector<Entity>& out
+) const {
+    if (k == 0 || m_items.empty())
+        return;
+
+    // Max heap storing the best k squared distances
+    using Candidate = std::pair<f32, u32>;
+    std::priority_queue<Candidate> best;
+
+    auto consider = [&](u32 item_index) {
+        glm::vec3 delta = m_items[item_index].position - point;
+        f32 dist_sq = glm::dot(delta, delta);
+
+        if (best.size() < k) {
+            best.emplace(dist_sq, item_index);
+        } else if (dist_sq < best.top().first) {
+            best.pop();
+            best.emplace(dist_sq, item_index);
+        }
+    };
+
+    // Visit rings of cells at growing distance from the point cell
+    Cell center = cellOf(point);
+    usize visited = 0;
+
+    for (i32 r = 0; visited < m_items.size(); r++) {
+        // If the ring is larger than the occupied grid
+        // it's faster to test all the remaining items
+        usize ring_cells = (r == 0) ? 1 : 24 * usize(r) * usize(r) + 2;
+        if (ring_cells > m_cells.size()) {
+            best = std::priority_queue<Candidate>();
+
+            for (u32 i = 0; i < m_items.size(); i++) {
+                consider(i);
+            }
+            break;
+        }
+
+        for (i32 x = -r; x <= r; x++) {
+        for (i32 y = -r; y <= r; y++) {
+            // Cells on the side of the ring need the full z range
+            bool side = (std::abs(x) == r || std::abs(y) == r);
+            i32 z_step = (side || r == 0) ? 1 : 2 * r;
+
+            for (i32 z = -r; z <= r; z += z_step) {
+                CellKey key = cellKey({
+                    center.x + x, center.y + y, center.z + z
+                });
+
+                auto cell_it = m_cells.find(key);
+                if (cell_it == m_cells.end())
+                    continue;
+
+                for (u32 item_index : cell_it->second) {
+                    consider(item_index);
+                }
+                visited += cell_it->second.size();
+            }
+        }
+        }
+
+        // The items in the next rings are at least r cells away
+        f32 ring_distance = r * m_cell_size;
+        if (best.size() == k && best.top().first <= ring_distance * ring_distance)
+            break;
+    }
+
+    // Store the result sorted by distance
+    usize first = out.size();
+    out.resize(first + best.size());
+
+    for (usize i = out.size(); i != first; i--) {
+        out[i - 1] = m_items[best.top().second].entity;
+        best.pop();
+    }
+}
+
+// Return the cell containing the given point
+SpatialIndex::Cell SpatialIndex::cellOf(glm::vec3 point) const
+{
+    auto coord = [&](f32 value) {
+        f32 cell = std::floor(value * m_inv_cell_size);
+        cell = std::clamp(
+            cell,
+            static_cast<f32>(-cell_key_offset),
+            static_cast<f32>(cell_key_offset - 1)
+        );
+
+        return static_cast<i32>(cell);
+    };
+
+    return Cell { coord(point.x), coord(point.y), coord(point.z) };
+}
+
+// Pack the cell coordinates in a single key
+SpatialIndex::CellKey SpatialIndex::cellKey(Cell cell)
+{
+    u64 x = static_cast<u64>(cell.x + cell_key_offset) & cell_key_mask;
+    u64 y = static_cast<u64>(cell.y + cell_key_offset) & cell_key_mask;
+    u64 z = static_cast<u64>(cell.z + cell_key_offset) & cell_key_mask;
+
+    return x | (y << cell_key_bits) | (z << (2 * cell_key_bits));
+}
+
+// Insert or move an entity in the grid
+void SpatialIndex::placeItem(Entity entity, glm::vec3 position)
+{
+    if (entity.id() >= m_entity_items.size())
+        m_entity_items.resize(entity.id() + 1, invalid_item);
+
+    CellKey new_cell = cellKey(cellOf(position));
+    u32& item_index = m_entity_items[entity.id()];
+
+    // Add a new item to the index
+    if (item_index == invalid_item) {
+        std::vector<u32>& cell_items = m_cells[new_cell];
+
+        item_index = static_cast<u32>(m_items.size());
+        m_items.push_back(Item {
+            .entity = entity,
+            .position = position,
+            .half_extents = glm::vec3(0.0f),
+            .cell = new_cell,
+            .cell_slot = static_cast<u32>(cell_items.size()),
+            .stamp = m_stamp
+        });
+        cell_items.push_back(item_index);
+
+        return;
+    }
+
+    Item& item = m_items[item_index];
+    item.position = position;
+    item.half_extents = glm::vec3(0.0f);
+    item.stamp = m_stamp;
+
+    if (item.cell == new_cell)
+        return;
+
+    // Swap remove the item from the old cell
+    auto old_cell_it = m_cells.find(item.cell);
+    std::vector<u32>& old_items = old_cell_it->second;
+
+    old_items[item.cell_slot] = old_items.back();
+    m_items[old_items.back()].cell_slot = item.cell_slot;
+    old_items.pop_back();
+
+    if (old_items.empty())
+        m_cells.erase(old_cell_it);
+
+    // Insert the item in the new cell
+    std::vector<u32>& new_items = m_cells[new_cell];
+
+    item.cell = new_cell;
+    item.cell_slot = static_cast<u32>(new_items.size());
+    new_items.push_back(item_index);
+}
+
+// Remove the item at the given index from the grid and the items list
+void SpatialIndex::removeItem(u32 item_index)
+{
+    Item& item = m_items[item_index];
+
+    // Swap remove the item from its cell
+    auto cell_it = m_cells.find(item.cell);
+    std::vector<u32>& cell_items = cell_it->second;
+
+    cell_items[item.cell_slot] = cell_items.back();
+    m_items[cell_items.back()].cell_slot = item.cell_slot;
+    cell_items.pop_back();
+
+    if (cell_items.empty())
+        m_cells.erase(cell_it);
+
+    m_entity_items[item.entity.id()] = invalid_item;
+
+    // Move the last item in the free slot
+    u32 last_index = static_cast<u32>(m_items.size() - 1);
+    if (item_index != last_index) {
+        Item& last = m_items[last_index];
+
+        m_entity_items[last.entity.id()] = item_index;
+        m_cells[last.cell][last.cell_slot] = item_index;
+
+        m_items[item_index] = last;
+    }
+
+    m_items.pop_back();
+}
+
+// Call the given function for every item stored in the cells range
+template <typename Fn>
+void SpatialIndex::forEachInCells(Cell min, Cell max, Fn fn) const
+{
+    usize range_cells =
+        usize(max.x - min.x + 1) *
+        usize(max.y - min.y + 1) *
+        usize(max.z - min.z + 1);
+
+    // Iterate the occupied cells if the range is larger than the grid
+    if (range_cells > m_cells.size()) {
+        for (auto& [key, cell_items] : m_cells) {
+            i32 x = static_cast<i32>(key & cell_key_mask) - cell_key_offset;
+            i32 y = static_cast<i32>((key >> cell_key_bits) & cell_key_mask)
+                - cell_key_offset;
+            i32 z = static_cast<i32>((key >> (2 * cell_key_bits)) & cell_key_mask)
+                - cell_key_offset;
+
+            bool inside =
+                x >= min.x && x <= max.x &&
+                y >= min.y && y <= max.y &&
+                z >= min.z && z <= max.z;
+
+            if (!inside)
+                continue;
+
+            for (u32 item_index : cell_items) {
+                fn(m_items[item_index]);
+            }
+        }
+
+        return;
+    }
+
+    for (i32 x = min.x; x <= max.x; x++) {
+    for (i32 y = min.y; y <= max.y; y++) {
+    for (i32 z = min.z; z <= max.z; z++) {
+        auto cell_it = m_cells.find(cellKey({x, y, z}));
+        if (cell_it == m_cells.end())
+            continue;
+
+        for (u32 item_index : cell_it->second) {
+            fn(m_items[item_index]);
+        }
+    }
+    }
+    }
+}
+
+} // namespace cndt
@@ -1,9 +1,14 @@
 #include "conduit/ecs/world.h"
 #include "conduit/ecs/commandBuffer.h"
+#include "conduit/logging.h"
 
 namespace cndt {
 
-World::World(): m_entity_register() { }
+World::World(): 
+    m_frame_count(0),
+    m_stats_log_interval(0),
+    m_entity_register() 
+{ }
 
 Entity World::newEntity() 
 {
@@ -18,10 +23,100 @@ void World::deleteEntity(Entity entity)
     m_entity_register.deleteEntity(entity);    
 }
 
+// Create the given number of entities with contiguous ids and 
+// attach a copy of all the prefab components to each of them
+EntityRange World::instantiate(const Prefab& prefab, usize count)
+{
+    EntityRange range = m_entity_register.newEntityRange(count);
+
+    // Each component buffer is filled in a single append
+    for (auto& comp : prefab.m_components) {
+        comp.second->instantiate(m_component_register, range);
+    }
+
+    return range;
+}
+
 // Execute the commands from the given commands buffer
 void World::executeCmdBuffer(ECSCmdBuffer& cmd_buffer)
 {
     cmd_buffer.runCommands(this);
 }
 
+// Move all the entities and components of the other 
+// world to this world and return the entity remap
+EntityRemap World::merge(World&& other)
+{
+    if (&other == this) {
+        log::core::warn("World::merge -> can't merge a world with itself");
+        return EntityRemap();
+    }
+
+    EntityRemap remap = m_entity_register.merge(other.m_entity_register);
+    
+    m_component_register.merge(other.m_component_register, remap);
+
+    // The other world queries reference buffers moved to this world
+    other.m_query_register.clear();
+
+    return remap;
+}
+
+// Advance the world frame counter and log the statistics if needed
+void World::update()
+{
+    m_frame_count += 1;
+
+    if (m_stats_log_interval != 0 && 
+        m_frame_count % m_stats_log_interval == 0
+    ) {
+        logStats();
+    }
+}
+
+// Return a snapshot of the world statistics
+WorldStats World::stats()
+{
+    return WorldStats {
+        .entity_count = m_entity_register.entityCount(),
+        .free_entity_count = m_entity_register.freeEntityCount(),
+        .components = m_component_register.stats(),
+        .queries = m_query_register.stats()
+    };
+}
+
+// Log the world statistics on the core logger
+void World::logStats()
+{
+    WorldStats world_stats = stats();
+
+    log::core::info(
+        "ECS world stats (frame {}): {} entities, {} free ids",
+        m_frame_count,
+        world_stats.entity_count,
+        world_stats.free_entity_count
+    );
+
+    for (auto& comp : world_stats.components) {
+        log::core::info(
+            "    component [{}]: {} / {} elements, {} bytes",
+            comp.type_name,
+            comp.count,
+            comp.capacity,
+            comp.bytes
+        );
+    }
+
+    for (auto& query : world_stats.queries) {
+        log::core::info(
+            "    query [{}]: {} elements, {} rebuilds, last {} ns, total {} ns",
+            query.type_name,
+            query.element_count,
+            query.rebuild_count,
+            query.last_rebuild_ns,
+            query.total_rebuild_ns
+        );
+    }
+}
+
 } // namespace cndt
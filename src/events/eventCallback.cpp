@@ -5,21 +5,82 @@ namespace cndt::internal {
 // Default starting capacity of the buffers storage vectors
 constexpr usize default_callback_buffer_size = 5;
 
+// Number of events processed by a single thread safe callback job
+constexpr usize callback_job_chunk_size = 256;
+
 CallbackRegister::CallbackRegister()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_callback_buffers.reserve(default_callback_buffer_size);
 }
 
-// Execute all the callbacks in the register
-void CallbackRegister::executeCallback() 
+// Execute the callbacks of the event types active in the event register
+void CallbackRegister::executeCallback(
+    EventRegister& event_register,
+    ThreadPool* thread_pool_p
+) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // The active types are accessed by index because the callbacks
+    // can activate new types, the callbacks of the activated types
+    // run serially after the dispatched ones
+    usize dispatched = 0;
+    
+    if (thread_pool_p != nullptr) {
+        dispatched = event_register.collectActivated();
+        
+        // Split the thread safe callbacks events in jobs and run them 
+        // concurrently across all the active event types
+        m_jobs.clear();
+        for (usize i = 0; i < dispatched; i++) {
+            auto buffer_p = callbackBuffer(event_register.activeTypes()[i]);
+            
+            if (buffer_p != nullptr)
+                buffer_p->collectJobs(m_jobs, callback_job_chunk_size);
+        }
+
+        thread_pool_p->parallelFor(m_jobs.size(), [this](usize i) {
+            CallbackJob& job = m_jobs[i];
+            job.buffer_p->callRange(job.callback_index, job.begin, job.end);
+        });
+    }
+
+    // Run the serial callbacks on the calling thread
+    for (usize i = 0; i < event_register.collectActivated(); i++) {
+        auto buffer_p = callbackBuffer(event_register.activeTypes()[i]);
+        if (buffer_p == nullptr)
+            continue;
+        
+        if (i < dispatched)
+            buffer_p->callSerial();
+        else
+            buffer_p->callAll();
+    }
+}
+
+// Return the callback buffer of the given type
+CallbackBufferBase* CallbackRegister::callbackBuffer(u64 type_id)
+{
+    // The vector is indexed by type id so it can contain null buffers
+    if (type_id >= m_callback_buffers.size())
+        return nullptr;
+
+    return m_callback_buffers[type_id].get();
+}
+
+// Return the execution time statistics of all the callbacks
+std::vector<CallbackStats> CallbackRegister::stats() 
 {
     std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<CallbackStats> callbacks_stats;
     
-    // Execute the callback in all the callback buffers
     for (auto& buffer : m_callback_buffers) {
-        buffer->callAll();
+        if (buffer != nullptr)
+            buffer->stats(callbacks_stats);
     }
+
+    return callbacks_stats;
 }
 
 } // namespace cndt::internal
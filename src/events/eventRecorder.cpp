@@ -0,0 +1,305 @@
+#include "conduit/events/eventRecorder.h"
+#include "conduit/events/events.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace cndt {
+
+// Event log file identifier and format version
+constexpr u32 event_log_magic = 0x45444e43; // "CNDE"
+constexpr u32 event_log_version = 1;
+
+// Record header layout: frame, timestamp, tag, event size
+constexpr usize record_header_size =
+    sizeof(u64) + sizeof(f64) + sizeof(u32) + sizeof(u32);
+
+// Append a value bytes to the buffer
+template <typename Type>
+static void writeValue(std::vector<u8>& out, const Type& value)
+{
+    usize offset = out.size();
+
+    out.resize(offset + sizeof(Type));
+    std::memcpy(out.data() + offset, &value, sizeof(Type));
+}
+
+// Read a value from the buffer at the given offset
+template <typename Type>
+static Type readValue(const std::vector<u8>& data, usize offset)
+{
+    Type value;
+    std::memcpy(&value, data.data() + offset, sizeof(Type));
+
+    return value;
+}
+
+/*
+ *
+ *      Event recorder implementation
+ *
+ * */
+
+EventRecorder::EventRecorder(EventBus& event_bus) :
+    m_event_bus(event_bus),
+    m_state_p(std::make_shared<State>()),
+    m_tags()
+{ }
+
+EventRecorder::~EventRecorder()
+{
+    stop();
+}
+
+// Create the log file and start recording
+bool EventRecorder::start(const std::filesystem::path& path)
+{
+    stop();
+
+    m_state_p->file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_state_p->file.is_open()) {
+        log::core::error(
+            "EventRecorder::start -> can't create the event log: {}",
+            path.string()
+        );
+
+        return false;
+    }
+
+    // Write the log header
+    std::vector<u8> header;
+    writeValue(header, event_log_magic);
+    writeValue(header, event_log_version);
+
+    m_state_p->file.write(
+        reinterpret_cast<const char*>(header.data()),
+        header.size()
+    );
+
+    m_state_p->frame = 0;
+    m_state_p->clock.reset();
+    m_state_p->records.clear();
+    m_state_p->recording = true;
+
+    return true;
+}
+
+// Write the pending records and close the log file
+void EventRecorder::stop()
+{
+    if (!m_state_p->recording)
+        return;
+
+    update();
+
+    m_state_p->recording = false;
+    m_state_p->file.close();
+}
+
+// Return true if the recorder is writing to a log file
+bool EventRecorder::isRecording() const
+{
+    return m_state_p->recording;
+}
+
+// Record all the engine window, keyboard and mouse events
+void EventRecorder::recordEngineEvents()
+{
+    recordType<KeyPressEvent>(eventtag::KEY_PRESS);
+    recordType<KeyRepeatEvent>(eventtag::KEY_REPEAT);
+    recordType<KeyReleaseEvent>(eventtag::KEY_RELEASE);
+
+    recordType<MouseKeyPressEvent>(eventtag::MOUSE_KEY_PRESS);
+    recordType<MouseKeyReleaseEvent>(eventtag::MOUSE_KEY_RELEASE);
+    recordType<MouseScrollEvent>(eventtag::MOUSE_SCROLL);
+    recordType<MousePositionEvent>(eventtag::MOUSE_POSITION);
+
+    recordType<WindowCloseEvent>(eventtag::WINDOW_CLOSE);
+    recordType<WindowFocusGainEvent>(eventtag::WINDOW_FOCUS_GAIN);
+    recordType<WindowFocusLostEvent>(eventtag::WINDOW_FOCUS_LOST);
+    recordType<WindowResizeEvent>(eventtag::WINDOW_RESIZE);
+    recordType<WindowMoveEvent>(eventtag::WINDOW_MOVE);
+}
+
+// Write the records of the current frame and advance the frame
+void EventRecorder::update()
+{
+    if (!m_state_p->recording)
+        return;
+
+    auto& records = m_state_p->records;
+    if (!records.empty()) {
+        m_state_p->file.write(
+            reinterpret_cast<const char*>(records.data()),
+            records.size()
+        );
+
+        records.clear();
+    }
+
+    m_state_p->frame += 1;
+}
+
+// Register the tag, return false if it's already in use
+bool EventRecorder::addTag(u32 tag)
+{
+    if (!m_tags.insert(tag).second) {
+        log::core::warn(
+            "EventRecorder::recordType -> tag {} already recorded", tag
+        );
+
+        return false;
+    }
+
+    return true;
+}
+
+// Write a record header and return the record size offset
+usize EventRecorder::State::beginRecord(u32 tag)
+{
+    writeValue(records, frame);
+    writeValue(records, clock.elapsed());
+    writeValue(records, tag);
+
+    // The size is written after the event serialization
+    usize size_offset = records.size();
+    writeValue(records, u32(0));
+
+    return size_offset;
+}
+
+// Write the event size in the record header
+void EventRecorder::State::endRecord(usize size_offset)
+{
+    u32 size = records.size() - size_offset - sizeof(u32);
+    std::memcpy(records.data() + size_offset, &size, sizeof(u32));
+}
+
+/*
+ *
+ *      Event player implementation
+ *
+ * */
+
+EventPlayer::EventPlayer(EventWriter event_writer) :
+    m_event_writer(event_writer),
+    m_replay_fns(),
+    m_unknown_tags(),
+    m_data(),
+    m_offset(0),
+    m_frame(0)
+{ }
+
+// Load the log file, return false if it's missing or invalid
+bool EventPlayer::open(const std::filesystem::path& path)
+{
+    m_data.clear();
+    m_offset = 0;
+    m_frame = 0;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        log::core::error(
+            "EventPlayer::open -> event log not found: {}", path.string()
+        );
+
+        return false;
+    }
+
+    std::vector<u8> data(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+    );
+
+    // Check the log header
+    constexpr usize header_size = 2 * sizeof(u32);
+
+    if (data.size() < header_size ||
+        readValue<u32>(data, 0) != event_log_magic ||
+        readValue<u32>(data, sizeof(u32)) != event_log_version
+    ) {
+        log::core::error(
+            "EventPlayer::open -> invalid event log: {}", path.string()
+        );
+
+        return false;
+    }
+
+    m_data = std::move(data);
+    m_offset = header_size;
+
+    return true;
+}
+
+// Replay all the engine window, keyboard and mouse events
+void EventPlayer::registerEngineEvents()
+{
+    registerType<KeyPressEvent>(eventtag::KEY_PRESS);
+    registerType<KeyRepeatEvent>(eventtag::KEY_REPEAT);
+    registerType<KeyReleaseEvent>(eventtag::KEY_RELEASE);
+
+    registerType<MouseKeyPressEvent>(eventtag::MOUSE_KEY_PRESS);
+    registerType<MouseKeyReleaseEvent>(eventtag::MOUSE_KEY_RELEASE);
+    registerType<MouseScrollEvent>(eventtag::MOUSE_SCROLL);
+    registerType<MousePositionEvent>(eventtag::MOUSE_POSITION);
+
+    registerType<WindowCloseEvent>(eventtag::WINDOW_CLOSE);
+    registerType<WindowFocusGainEvent>(eventtag::WINDOW_FOCUS_GAIN);
+    registerType<WindowFocusLostEvent>(eventtag::WINDOW_FOCUS_LOST);
+    registerType<WindowResizeEvent>(eventtag::WINDOW_RESIZE);
+    registerType<WindowMoveEvent>(eventtag::WINDOW_MOVE);
+}
+
+// Send the events recorded in the current frame and advance the frame
+void EventPlayer::update()
+{
+    while (m_offset + record_header_size <= m_data.size()) {
+        usize offset = m_offset;
+
+        u64 frame = readValue<u64>(m_data, offset);
+        if (frame > m_frame)
+            break;
+
+        offset += sizeof(u64) + sizeof(f64);
+        u32 tag = readValue<u32>(m_data, offset);
+
+        offset += sizeof(u32);
+        u32 size = readValue<u32>(m_data, offset);
+
+        offset += sizeof(u32);
+        if (offset + size > m_data.size()) {
+            log::core::error("EventPlayer::update -> truncated event log");
+
+            m_offset = m_data.size();
+            break;
+        }
+
+        m_offset = offset + size;
+
+        // Send the event if its type is registered
+        auto replay_it = m_replay_fns.find(tag);
+        if (replay_it == m_replay_fns.end()) {
+            if (m_unknown_tags.insert(tag).second) {
+                log::core::warn(
+                    "EventPlayer::update -> unknown event tag {}", tag
+                );
+            }
+
+            continue;
+        }
+
+        replay_it->second(
+            std::span<const u8>(m_data.data() + offset, size),
+            m_event_writer
+        );
+    }
+
+    // A trailing partial header can't be replayed
+    if (m_offset + record_header_size > m_data.size())
+        m_offset = m_data.size();
+
+    m_frame += 1;
+}
+
+} // namespace cndt
@@ -2,14 +2,91 @@
 
 namespace cndt::internal {
 
-// Swap and clear the event buffers
+EventRegister::EventRegister() :
+    m_event_buffers(),
+    m_activation_list_p(std::make_shared<EventActivationList>()),
+    m_active_types(),
+    m_event_channels(),
+    m_time_wheel(std::make_shared<TimerWheel>()),
+    m_frame_wheel(std::make_shared<TimerWheel>()),
+    m_clock(),
+    m_start_ms(m_clock.nowMs())
+{ }
+
+// Swap and clear the active event buffers, freeze the buffers
+// left without events and expire the channels events
 void EventRegister::update() 
 {
     std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    collectActivated();
+    
+    // Update the buffers and remove the frozen ones keeping 
+    // the activation order, a frozen buffer receiving an event
+    // during the update is added back by the next collection
+    std::erase_if(m_active_types, [this](TypeId type_id) {
+        auto& buffer = m_event_buffers[type_id];
+        buffer->update();
+
+        return buffer->tryFreeze();
+    });
+
+    for (auto& channel : m_event_channels) {
+        channel.second->update();
+    }
+}
+
+// Move the concurrently sent events to the current event buffers
+void EventRegister::publish() 
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    collectActivated();
+    
+    for (auto type_id : m_active_types) {
+        m_event_buffers[type_id]->publish();
+    }
+}
+
+// Add the types activated since the last call to the active types
+usize EventRegister::collectActivated()
+{
+    m_activation_list_p->drain(m_active_types);
+
+    return m_active_types.size();
+}
+
+// Send the scheduled events expired at the given bus update count
+// or before the current time
+void EventRegister::fireTimers(u64 update_count) 
+{
+    m_frame_wheel->advance(update_count);
+    m_time_wheel->advance(elapsedMs());
+}
+
+// Return the milliseconds since the register creation,
+// the engine clock is not monotonic so it's clamped to zero
+u64 EventRegister::elapsedMs() const
+{
+    u64 now_ms = m_clock.nowMs();
+    
+    return now_ms > m_start_ms ? now_ms - m_start_ms : 0;
+}
+
+// Return the statistics of all the event buffers
+std::vector<EventBufferStats> EventRegister::stats() 
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    std::vector<EventBufferStats> buffers_stats;
+    buffers_stats.reserve(m_event_buffers.size());
     
     for (auto& buffer : m_event_buffers) {
-        buffer.second->update();
+        if (buffer != nullptr)
+            buffers_stats.push_back(buffer->stats());
     }
+
+    return buffers_stats;
 }
 
 } // namespace cndt::internal
@@ -1,5 +1,6 @@
 #include "conduit/events/eventBus.h"
 #include "conduit/events/eventWriter.h"
+#include "conduit/logging.h"
 
 #include <memory>
 
@@ -7,7 +8,13 @@ namespace cndt {
 
 // Construct the event bus
 EventBus::EventBus() :
-    m_event_register(std::make_shared<internal::EventRegister>()) 
+    m_event_register(std::make_shared<internal::EventRegister>()),
+    m_callback_register(),
+    m_thread_pool_p(nullptr),
+    m_update_count(0),
+    m_stats_log_interval(0),
+    m_wait_mutex(),
+    m_wait_lists()
 { }
 
 EventBus::~EventBus() { }
@@ -19,12 +26,103 @@ EventWriter EventBus::getEventWriter() {
 
 // Swap the event buffers and run all the callbacks
 void EventBus::update() {
+    // Send the expired scheduled events
+    m_event_register->fireTimers(m_update_count);
+    
+    // Make the concurrently sent events visible to the callbacks
+    m_event_register->publish();
+
+    // Resume the coroutines before the callbacks
+    // so the callbacks see the events they send
+    resumeWaiters();
+    
     // Executing all the callbacks before swapping buffer
     // in event register update
-    m_callback_register.executeCallback();
+    m_callback_register.executeCallback(
+        *m_event_register, 
+        m_thread_pool_p
+    );
     
     // Update the event register
     m_event_register->update();
+
+    m_update_count += 1;
+
+    if (m_stats_log_interval != 0 && 
+        m_update_count % m_stats_log_interval == 0
+    ) {
+        logStats();
+    }
+}
+
+// Resume the coroutines waiting for the current events
+void EventBus::resumeWaiters() {
+    // Only the active types can have current events, the resumed 
+    // coroutines can add wait lists and activate types so both
+    // vectors are accessed by index
+    for (usize i = 0; i < m_event_register->collectActivated(); i++) {
+        auto type_id = m_event_register->activeTypes()[i];
+        
+        internal::EventWaitListBase* wait_list_p = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_wait_mutex);
+            
+            if (type_id < m_wait_lists.size())
+                wait_list_p = m_wait_lists[type_id].get();
+        }
+
+        if (wait_list_p != nullptr)
+            wait_list_p->resume();
+    }
+}
+
+// Return a snapshot of the event bus statistics
+EventBusStats EventBus::stats()
+{
+    return EventBusStats {
+        .update_count = m_update_count,
+        .buffers = m_event_register->stats(),
+        .callbacks = m_callback_register.stats()
+    };
+}
+
+// Log the event bus statistics on the core logger
+void EventBus::logStats()
+{
+    EventBusStats bus_stats = stats();
+
+    log::core::info(
+        "Event bus stats (update {}): {} event types, {} callbacks",
+        bus_stats.update_count,
+        bus_stats.buffers.size(),
+        bus_stats.callbacks.size()
+    );
+
+    for (auto& buffer : bus_stats.buffers) {
+        log::core::info(
+            "    events [{}]: {} last update, {} total, {} peak, "
+            "{} capacity, {} bytes",
+            buffer.type_name,
+            buffer.last_update_events,
+            buffer.total_events,
+            buffer.high_water_mark,
+            buffer.capacity,
+            buffer.bytes
+        );
+    }
+
+    for (auto& callback : bus_stats.callbacks) {
+        log::core::info(
+            "    callback [{}] #{}{}: {} events, total {} ns, max {} ns",
+            callback.type_name,
+            callback.callback_index,
+            callback.keyed ? " keyed" : 
+                (callback.thread_safe ? " thread safe" : ""),
+            callback.event_count,
+            callback.total_ns,
+            callback.max_ns
+        );
+    }
 }
 
 } // namespace cndt
@@ -0,0 +1,42 @@
+#include "conduit/events/inputChannel.h"
+#include "conduit/logging.h"
+
+namespace cndt {
+
+InputChannel::InputChannel(usize capacity) :
+    m_queue(capacity),
+    m_dropped(0),
+    m_reported_dropped(0),
+    m_clock()
+{ }
+
+// Send all the stored input events to the event bus
+usize InputChannel::drain(EventWriter& writer)
+{
+    // Report the events dropped since the last drain
+    u64 dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped != m_reported_dropped) {
+        log::core::warn(
+            "InputChannel::drain -> {} input events dropped, "
+            "the channel is full",
+            dropped - m_reported_dropped
+        );
+
+        m_reported_dropped = dropped;
+    }
+
+    return drain([&writer](const TimedInputEvent& timed_event) {
+        std::visit(
+            [&writer](const auto& event) { writer.send(event); },
+            timed_event.event
+        );
+    });
+}
+
+// Return the number of events dropped because the channel was full
+u64 InputChannel::dropped() const
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+} // namespace cndt
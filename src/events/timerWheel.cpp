@@ -0,0 +1,264 @@
+#include "conduit/internal/events/timerWheel.h"
+
+#include <bit>
+#include <utility>
+
+namespace cndt::internal {
+
+/*
+ *
+ *      Timer wheel implementation
+ *
+ * */
+
+TimerWheel::TimerWheel() :
+    m_current(0),
+    m_timers(),
+    m_free_timers(),
+    m_active_count(0),
+    m_levels(),
+    m_due(),
+    m_fired()
+{ }
+
+// Schedule the function at the given tick
+TimerWheel::TimerId TimerWheel::schedule(u64 tick, TimerWheel::FireFn fire_fn)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Reuse a released timer slot if available
+    u32 index;
+    if (!m_free_timers.empty()) {
+        index = m_free_timers.back();
+        m_free_timers.pop_back();
+    } else {
+        index = m_timers.size();
+        m_timers.push_back(Timer {
+            .fire_fn = nullptr,
+            .expiry = 0,
+            .generation = 0,
+            .active = false
+        });
+    }
+
+    Timer& timer = m_timers[index];
+    timer.fire_fn = std::move(fire_fn);
+    timer.expiry = tick;
+    timer.active = true;
+
+    m_active_count += 1;
+
+    TimerId id = { .index = index, .generation = timer.generation };
+    place(id);
+
+    return id;
+}
+
+// Cancel a pending timer, return false if it already fired
+bool TimerWheel::cancel(TimerWheel::TimerId id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!isActive(id))
+        return false;
+
+    // The slots references are discarded lazily by the generation check
+    release(id.index);
+
+    return true;
+}
+
+// Return true if the timer has not fired or been cancelled
+bool TimerWheel::pending(TimerWheel::TimerId id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return isActive(id);
+}
+
+// Advance the wheel to the given tick and call
+// the functions of all the expired timers
+void TimerWheel::advance(u64 tick)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Fire the timers scheduled at an already reached tick
+        Slot due = std::move(m_due);
+        m_due.clear();
+
+        for (auto id : due) {
+            expire(id);
+        }
+
+        while (m_current < tick) {
+            // Without pending timers the slots contain only cancelled ones
+            if (m_active_count == 0) {
+                m_current = tick;
+                break;
+            }
+
+            m_current += 1;
+
+            // Find the upper levels reaching a new slot, the lower
+            // levels complete a rotation when their bits are all zero
+            usize top_level = 0;
+            while (top_level + 1 < timer_wheel_levels) {
+                usize shift = (top_level + 1) * timer_wheel_level_bits;
+                
+                if ((m_current & ((u64(1) << shift) - 1)) != 0)
+                    break;
+
+                top_level += 1;
+            }
+
+            // Move down the timers starting from the highest level,
+            // so the timers moved to a lower level reaching a new slot
+            // in the same tick are moved down again
+            for (usize level = top_level; level > 0; level--) {
+                usize shift = level * timer_wheel_level_bits;
+                cascade(level, (m_current >> shift) % timer_wheel_slots);
+            }
+
+            // Fire the timers in the current slot
+            Slot& slot = m_levels[0][m_current % timer_wheel_slots];
+            Slot expired = std::move(slot);
+            slot.clear();
+
+            for (auto id : expired) {
+                expire(id);
+            }
+        }
+    }
+
+    // Call the functions without the lock so they can schedule timers
+    std::vector<FireFn> fired;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        fired.swap(m_fired);
+    }
+
+    for (auto& fire_fn : fired) {
+        fire_fn();
+    }
+}
+
+// Return the last tick reached by the wheel
+u64 TimerWheel::currentTick()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_current;
+}
+
+// Return the number of pending timers
+usize TimerWheel::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_active_count;
+}
+
+// Store the timer in the slot matching its expiry
+void TimerWheel::place(TimerWheel::TimerId id)
+{
+    u64 expiry = m_timers[id.index].expiry;
+
+    if (expiry <= m_current) {
+        m_due.push_back(id);
+        return;
+    }
+
+    // Select the level from the highest bit differing from the current
+    // tick, the timers too far in the future are stored in the last 
+    // level and moved back to it until their expiry is in range
+    u64 delta = expiry - m_current;
+    usize level = (std::bit_width(delta) - 1) / timer_wheel_level_bits;
+
+    if (level >= timer_wheel_levels)
+        level = timer_wheel_levels - 1;
+
+    usize shift = level * timer_wheel_level_bits;
+    m_levels[level][(expiry >> shift) % timer_wheel_slots].push_back(id);
+}
+
+// Move the timers of a level slot to the lower levels
+void TimerWheel::cascade(usize level, usize slot)
+{
+    Slot timers = std::move(m_levels[level][slot]);
+    m_levels[level][slot].clear();
+
+    for (auto id : timers) {
+        if (isActive(id))
+            place(id);
+    }
+
+    // The timers expiring now are fired with the current slot
+    Slot due = std::move(m_due);
+    m_due.clear();
+
+    for (auto id : due) {
+        expire(id);
+    }
+}
+
+// Release the timer and move its function to the fired list
+void TimerWheel::expire(TimerWheel::TimerId id)
+{
+    if (!isActive(id))
+        return;
+
+    m_fired.push_back(std::move(m_timers[id.index].fire_fn));
+    release(id.index);
+}
+
+// Release a timer slot for reuse
+void TimerWheel::release(u32 index)
+{
+    Timer& timer = m_timers[index];
+
+    timer.fire_fn = nullptr;
+    timer.active = false;
+    timer.generation += 1;
+
+    m_active_count -= 1;
+    m_free_timers.push_back(index);
+}
+
+// Return true if the id reference an active timer
+bool TimerWheel::isActive(TimerWheel::TimerId id) const
+{
+    return id.index < m_timers.size() &&
+        m_timers[id.index].active &&
+        m_timers[id.index].generation == id.generation;
+}
+
+} // namespace cndt::internal
+
+namespace cndt {
+
+/*
+ *
+ *      Timer handle implementation
+ *
+ * */
+
+// Cancel the scheduled event
+bool TimerHandle::cancel()
+{
+    if (auto wheel = m_wheel_p.lock())
+        return wheel->cancel(m_id);
+
+    return false;
+}
+
+// Return true if the event is still waiting to be sent
+bool TimerHandle::pending() const
+{
+    if (auto wheel = m_wheel_p.lock())
+        return wheel->pending(m_id);
+
+    return false;
+}
+
+} // namespace cndt
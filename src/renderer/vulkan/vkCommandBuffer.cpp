@@ -53,7 +53,7 @@ void CommandBuffer::begin(
 } 
 
 // Record the command buffer with the given function
-void CommandBuffer::record(std::function<void(VkCommandBuffer)> record_fun)
+void CommandBuffer::record(FunctionRef<void(VkCommandBuffer)> record_fun)
 {
     // Make sure the buffer is in the recording state
     if (state() != State::Recording) {
@@ -2,8 +2,8 @@
 #define CNDT_VK_COMMAND_BUFFER_H
 
 #include "conduit/defines.h"
+#include "conduit/internal/core/functionRef.h"
 
-#include <functional>
 #include <string_view>
 
 #include <vulkan/vulkan_core.h>
@@ -59,7 +59,7 @@ public:
     );
     
     // Record the command buffer with the given function
-    void record(std::function<void(VkCommandBuffer)> record_fun);
+    void record(FunctionRef<void(VkCommandBuffer)> record_fun);
 
     // End command buffer recording
     void end();
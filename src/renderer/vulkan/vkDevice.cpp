@@ -1182,7 +1182,7 @@ void Device::destroyCmdPool(CommandPool cmd_pool)
 // Execute the command in the given function and wait 
 // for them to complete on the CPU
 void Device::runCmdImmediate(
-    std::function<void(VkCommandBuffer)> immediate_fun
+    FunctionRef<void(VkCommandBuffer)> immediate_fun
 ) {
     // Record the immediate command
     m_general_cmd_buf.begin();
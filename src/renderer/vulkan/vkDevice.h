@@ -212,7 +212,7 @@ public:
     // Execute the command in the given function and wait 
     // for them to complete on the CPU
     void runCmdImmediate(
-        std::function<void(VkCommandBuffer)> immediate_fun
+        FunctionRef<void(VkCommandBuffer)> immediate_fun
     );
 
     /*
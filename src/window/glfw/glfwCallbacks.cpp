@@ -19,7 +19,7 @@ namespace cndt::glfw {
 void GlfwWindow::callback_mouse_button_event(
     GLFWwindow* glfw_window, int button, int action, int mods
 ) {
-    EventWriter& writer = GET_EVENT_WRITER(glfw_window);
+    GlfwWindow* window = GET_WINDOW(glfw_window);
     
     switch (action) {
         case GLFW_PRESS: {
@@ -27,7 +27,9 @@ void GlfwWindow::callback_mouse_button_event(
                 .button_code = static_cast<u32>(button),
                 .mods = static_cast<u32>(mods)
             }; 
-            writer.send(event);
+            window->m_input_state.buttonPress(event.button_code);
+            window->sendInput(event);
+            break;
         }
         
         case GLFW_RELEASE: {
@@ -35,7 +37,9 @@ void GlfwWindow::callback_mouse_button_event(
                 .button_code = static_cast<u32>(button),
                 .mods = static_cast<u32>(mods)
             }; 
-            writer.send(event);
+            window->m_input_state.buttonRelease(event.button_code);
+            window->sendInput(event);
+            break;
         }
     }
 }
@@ -44,26 +48,28 @@ void GlfwWindow::callback_mouse_button_event(
 void GlfwWindow::callback_cursor_pos_event(
     GLFWwindow* glfw_window, double x_pos, double y_pos
 ) {
-    EventWriter& writer = GET_EVENT_WRITER(glfw_window);
+    GlfwWindow* window = GET_WINDOW(glfw_window);
 
     MousePositionEvent event = {
         .x_pos = x_pos,
         .y_pos = y_pos
     };
-    writer.send(event);
+    window->m_input_state.mouseMove(x_pos, y_pos);
+    window->sendInput(event, window->m_mouse_position_writer);
 }
 
 // Callback functions for mouse scrolling events 
 void GlfwWindow::callback_scroll_event(
     GLFWwindow* glfw_window, double x_offset, double y_offset
 ) {
-    EventWriter& writer = GET_EVENT_WRITER(glfw_window);
+    GlfwWindow* window = GET_WINDOW(glfw_window);
 
     MouseScrollEvent event = {
         .x_scroll = x_offset,
         .y_scroll = y_offset
     };
-    writer.send(event);
+    window->m_input_state.scroll(x_offset, y_offset);
+    window->sendInput(event, window->m_mouse_scroll_writer);
     
 }
 
@@ -71,7 +77,7 @@ void GlfwWindow::callback_scroll_event(
 void GlfwWindow::callback_key_event(
     GLFWwindow* glfw_window, int key, int, int action, int mods
 ) {
-    EventWriter& writer = GET_EVENT_WRITER(glfw_window);
+    GlfwWindow* window = GET_WINDOW(glfw_window);
 
     switch (action) {
         case GLFW_PRESS: {
@@ -79,7 +85,9 @@ void GlfwWindow::callback_key_event(
                 .key_code = static_cast<u32>(key),
                 .mods = static_cast<u32>(mods)
             }; 
-            writer.send(event);
+            window->m_input_state.keyPress(event.key_code);
+            window->sendInput(event);
+            break;
         }
 
         case GLFW_REPEAT: {
@@ -87,7 +95,8 @@ void GlfwWindow::callback_key_event(
                 .key_code = static_cast<u32>(key),
                 .mods = static_cast<u32>(mods)
             }; 
-            writer.send(event);
+            window->sendInput(event);
+            break;
         }
         
         case GLFW_RELEASE: {
@@ -95,7 +104,9 @@ void GlfwWindow::callback_key_event(
                 .key_code = static_cast<u32>(key),
                 .mods = static_cast<u32>(mods)
             }; 
-            writer.send(event);
+            window->m_input_state.keyRelease(event.key_code);
+            window->sendInput(event);
+            break;
         }
     }
 }
@@ -112,6 +123,18 @@ void GlfwWindow::callback_cursor_entered_event(
         writer.send(WindowFocusLostEvent());
 }
 
+// Callback functions for window focus events
+void GlfwWindow::callback_window_focus_event(
+    GLFWwindow* glfw_window, int focused
+) {
+    GlfwWindow* window = GET_WINDOW(glfw_window);
+
+    // The release events of the keys held while the window
+    // is not focused are never received
+    if (!focused)
+        window->m_input_state.releaseAll();
+}
+
 // Callback functions for window move events
 void GlfwWindow::callback_window_move_event(
     GLFWwindow* glfw_window, int x_pos, int y_pos
@@ -18,8 +18,19 @@
 namespace cndt::glfw {
 
 // Glfw window constructor
-GlfwWindow::GlfwWindow(EventWriter event_writer) : 
+GlfwWindow::GlfwWindow(
+    EventWriter event_writer,
+    InputChannel* input_channel_p
+) : 
     m_event_writer(event_writer), 
+    m_mouse_position_writer(
+        m_event_writer.getTypedWriter<MousePositionEvent>()
+    ),
+    m_mouse_scroll_writer(
+        m_event_writer.getTypedWriter<MouseScrollEvent>()
+    ),
+    m_input_channel_p(input_channel_p),
+    m_input_state(),
     m_fullscreen(false),
     m_current_data(),
     m_old_data(),
@@ -151,6 +162,7 @@ void GlfwWindow::initialize(
     glfwSetWindowPosCallback(m_glfw_window, callback_window_move_event);
     glfwSetWindowCloseCallback(m_glfw_window, callback_window_close_event);
     glfwSetCursorEnterCallback(m_glfw_window, callback_cursor_entered_event);
+    glfwSetWindowFocusCallback(m_glfw_window, callback_window_focus_event);
     glfwSetFramebufferSizeCallback(
         m_glfw_window, callback_buffer_resize_event
     );
@@ -285,10 +297,19 @@ void GlfwWindow::releaseCursor()
     glfwSetInputMode(m_glfw_window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 }
 
+// Return the input state snapshot of the last pooled frame
+InputSnapshot GlfwWindow::input()
+{
+    return m_input_state.snapshot();
+}
+
 // Pool the window event and send them to the event bus
 void GlfwWindow::poolEvents() 
 {
     glfwPollEvents();
+
+    // Publish the input received during the pool
+    m_input_state.publish();
 }
 
 } // namespace cndt::glfw
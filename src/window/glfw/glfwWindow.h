@@ -3,7 +3,10 @@
 
 #include "conduit/config/engineConfig.h"
 #include "conduit/events/eventWriter.h"
+#include "conduit/events/events.h"
+#include "conduit/events/inputChannel.h"
 #include "conduit/renderer/backendEnum.h"
+#include "conduit/window/inputState.h"
 #include "conduit/window/window.h"
 
 struct GLFWwindow;
@@ -21,7 +24,12 @@ private:
     };
 
 public:
-    GlfwWindow(EventWriter event_writer);
+    // If an input channel is given the input events are timestamped
+    // and sent to the channel instead of being sent to the bus
+    GlfwWindow(
+        EventWriter event_writer,
+        InputChannel* input_channel_p = nullptr
+    );
     ~GlfwWindow() override;
 
     // Obtain the current window data 
@@ -42,6 +50,9 @@ public:
     void captureCursor() override;
     // Release the cursor and disable raw input if available
     void releaseCursor() override;
+
+    // Return the input state snapshot of the last pooled frame
+    InputSnapshot input() override;
     
 private:
     // Initialize the glfw window
@@ -58,6 +69,16 @@ private:
     // Pool the window event and send them to the event bus
     void poolEvents() override;
 
+    // Send an input event to the input channel if available,
+    // the writer is used to send the event to the bus otherwise
+    template <class EventType>
+    void sendInput(
+        const EventType& event,
+        TypedEventWriter<EventType>& writer
+    );
+    template <class EventType>
+    void sendInput(const EventType& event);
+
 // OpenGL implementation functions
 public:
     // Swap buffer for the OpenGL context
@@ -84,6 +105,16 @@ private:
     // Used to send window event to the application bus
     EventWriter m_event_writer;
 
+    // Cached writers for the high frequency mouse events
+    TypedEventWriter<MousePositionEvent> m_mouse_position_writer;
+    TypedEventWriter<MouseScrollEvent> m_mouse_scroll_writer;
+
+    // Channel receiving the input events, can be null
+    InputChannel* m_input_channel_p;
+
+    // Polled keyboard and mouse state
+    InputState m_input_state;
+
     // Current fullscreen status
     bool m_fullscreen;
 
@@ -119,6 +150,10 @@ private:
     static void callback_cursor_entered_event(
         GLFWwindow* window, int entered
     );
+    // Callback functions for window focus events
+    static void callback_window_focus_event(
+        GLFWwindow* window, int focused
+    );
     // Callback functions for window move events
     static void callback_window_move_event(
         GLFWwindow* window, int xpos, int ypos
@@ -140,6 +175,34 @@ private:
     static void callback_error(int error_code, const char* error_msg);
 };
 
+/*
+ *
+ *      Glfw window template implementation
+ *
+ * */
+
+// Send an input event to the input channel or to the given writer
+template <class EventType>
+void GlfwWindow::sendInput(
+    const EventType& event,
+    TypedEventWriter<EventType>& writer
+) {
+    if (m_input_channel_p != nullptr)
+        m_input_channel_p->send(event);
+    else
+        writer.send(event);
+}
+
+// Send an input event to the input channel or to the event bus
+template <class EventType>
+void GlfwWindow::sendInput(const EventType& event)
+{
+    if (m_input_channel_p != nullptr)
+        m_input_channel_p->send(event);
+    else
+        m_event_writer.send(event);
+}
+
 } // namespace cndt::glfw
 
 #endif
@@ -0,0 +1,156 @@
+#include "conduit/window/inputState.h"
+
+namespace cndt {
+
+/*
+ *
+ *      Input snapshot implementation
+ *
+ * */
+
+// Return true if the key is held down
+bool InputSnapshot::isKeyDown(u32 key_code) const
+{
+    return key_code < key_count && keys_down.test(key_code);
+}
+
+// Return true if the key was pressed during the frame
+bool InputSnapshot::isKeyPressed(u32 key_code) const
+{
+    return key_code < key_count && keys_pressed.test(key_code);
+}
+
+// Return true if the key was released during the frame
+bool InputSnapshot::isKeyReleased(u32 key_code) const
+{
+    return key_code < key_count && keys_released.test(key_code);
+}
+
+// Return true if the mouse button is held down
+bool InputSnapshot::isButtonDown(u32 button_code) const
+{
+    return button_code < button_count && buttons_down.test(button_code);
+}
+
+// Return true if the mouse button was pressed during the frame
+bool InputSnapshot::isButtonPressed(u32 button_code) const
+{
+    return button_code < button_count && buttons_pressed.test(button_code);
+}
+
+// Return true if the mouse button was released during the frame
+bool InputSnapshot::isButtonReleased(u32 button_code) const
+{
+    return button_code < button_count && buttons_released.test(button_code);
+}
+
+/*
+ *
+ *      Input state implementation
+ *
+ * */
+
+InputState::InputState() :
+    m_pending(),
+    m_has_mouse_position(false),
+    m_snapshot()
+{ }
+
+// Return the last published snapshot
+InputSnapshot InputState::snapshot() const
+{
+    return m_snapshot.load();
+}
+
+// Return the number of published frames
+u64 InputState::frame() const
+{
+    return m_snapshot.version();
+}
+
+void InputState::keyPress(u32 key_code)
+{
+    if (key_code >= InputSnapshot::key_count)
+        return;
+
+    m_pending.keys_down.set(key_code);
+    m_pending.keys_pressed.set(key_code);
+}
+
+void InputState::keyRelease(u32 key_code)
+{
+    if (key_code >= InputSnapshot::key_count)
+        return;
+
+    m_pending.keys_down.reset(key_code);
+    m_pending.keys_released.set(key_code);
+}
+
+void InputState::buttonPress(u32 button_code)
+{
+    if (button_code >= InputSnapshot::button_count)
+        return;
+
+    m_pending.buttons_down.set(button_code);
+    m_pending.buttons_pressed.set(button_code);
+}
+
+void InputState::buttonRelease(u32 button_code)
+{
+    if (button_code >= InputSnapshot::button_count)
+        return;
+
+    m_pending.buttons_down.reset(button_code);
+    m_pending.buttons_released.set(button_code);
+}
+
+void InputState::mouseMove(f64 x_pos, f64 y_pos)
+{
+    // The first position has no previous one to compute the delta
+    if (m_has_mouse_position) {
+        m_pending.mouse_delta_x += x_pos - m_pending.mouse_x;
+        m_pending.mouse_delta_y += y_pos - m_pending.mouse_y;
+    }
+
+    m_pending.mouse_x = x_pos;
+    m_pending.mouse_y = y_pos;
+    m_has_mouse_position = true;
+}
+
+void InputState::scroll(f64 x_offset, f64 y_offset)
+{
+    m_pending.scroll_x += x_offset;
+    m_pending.scroll_y += y_offset;
+}
+
+// Release all the keys and buttons
+void InputState::releaseAll()
+{
+    m_pending.keys_released |= m_pending.keys_down;
+    m_pending.buttons_released |= m_pending.buttons_down;
+
+    m_pending.keys_down.reset();
+    m_pending.buttons_down.reset();
+}
+
+// Publish the accumulated input as the new snapshot
+void InputState::publish()
+{
+    m_snapshot.store(m_pending);
+
+    // Reset the per frame edges and deltas, the held keys
+    // and the mouse position carry over to the next frame
+    m_pending.keys_pressed.reset();
+    m_pending.keys_released.reset();
+    m_pending.buttons_pressed.reset();
+    m_pending.buttons_released.reset();
+
+    m_pending.mouse_delta_x = 0.0;
+    m_pending.mouse_delta_y = 0.0;
+    m_pending.scroll_x = 0.0;
+    m_pending.scroll_y = 0.0;
+
+    m_pending.frame++;
+}
+
+} // namespace cndt
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include "conduit/components/bounds.h"
+#include "conduit/components/transform.h"
+
+#include "conduit/ecs/spatialIndex.h"
+#include "conduit/ecs/world.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// Create an entity with a transform at the given position
+Entity spawn(World& world, glm::vec3 position)
+{
+    Entity entity = world.newEntity();
+
+    Transform transform;
+    transform.position() = position;
+    world.attachComponent<Transform>(entity, transform);
+
+    return entity;
+}
+
+// Sort the entities by id to compare query results
+std::vector<u32> sortedIds(const std::vector<Entity>& entities)
+{
+    std::vector<u32> ids;
+    for (auto entity : entities) {
+        ids.push_back(entity.id());
+    }
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+TEST(spatial_query_test, spatial_test) {
+    World world;
+    SpatialIndex index(4.0f);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<f32> dist(-50.0f, 50.0f);
+
+    std::vector<Entity> entities;
+    std::vector<glm::vec3> positions;
+
+    for (usize i = 0; i < 500; i++) {
+        glm::vec3 position(dist(rng), dist(rng), dist(rng));
+
+        entities.push_back(spawn(world, position));
+        positions.push_back(position);
+    }
+
+    index.update(world);
+    ASSERT_EQ(index.size(), 500);
+
+    // Radius query against brute force
+    {
+        glm::vec3 center(3.0f, -2.0f, 10.0f);
+        f32 radius = 15.0f;
+
+        std::vector<Entity> expected;
+        for (usize i = 0; i < entities.size(); i++) {
+            if (glm::length(positions[i] - center) <= radius)
+                expected.push_back(entities[i]);
+        }
+
+        std::vector<Entity> result;
+        index.queryRadius(center, radius, result);
+
+        ASSERT_EQ(sortedIds(result), sortedIds(expected));
+    }
+
+    // Box query against brute force
+    {
+        glm::vec3 min(-20.0f, 0.0f, -5.0f);
+        glm::vec3 max(10.0f, 30.0f, 25.0f);
+
+        std::vector<Entity> expected;
+        for (usize i = 0; i < entities.size(); i++) {
+            glm::vec3 p = positions[i];
+
+            if (p.x >= min.x && p.x <= max.x &&
+                p.y >= min.y && p.y <= max.y &&
+                p.z >= min.z && p.z <= max.z)
+                expected.push_back(entities[i]);
+        }
+
+        std::vector<Entity> result;
+        index.queryAabb(min, max, result);
+
+        ASSERT_EQ(sortedIds(result), sortedIds(expected));
+    }
+
+    // Nearest neighbors against brute force
+    {
+        glm::vec3 point(12.0f, 5.0f, -7.0f);
+
+        std::vector<usize> order(entities.size());
+        for (usize i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](usize a, usize b) {
+            return glm::length(positions[a] - point) <
+                glm::length(positions[b] - point);
+        });
+
+        std::vector<Entity> result;
+        index.queryNearest(point, 8, result);
+
+        ASSERT_EQ(result.size(), 8);
+        for (usize i = 0; i < result.size(); i++) {
+            ASSERT_EQ(result[i].id(), entities[order[i]].id());
+        }
+    }
+}
+
+TEST(spatial_update_test, spatial_test) {
+    World world;
+    SpatialIndex index(4.0f);
+
+    Entity first = spawn(world, glm::vec3(0.0f));
+    Entity second = spawn(world, glm::vec3(100.0f, 0.0f, 0.0f));
+
+    index.update(world);
+
+    std::vector<Entity> result;
+    index.queryRadius(glm::vec3(0.0f), 1.0f, result);
+    ASSERT_EQ(result.size(), 1);
+    ASSERT_EQ(result[0].id(), first.id());
+
+    // Move the second entity next to the origin
+    {
+        auto query = world.getQuery<Transform>();
+        for (auto element : query) {
+            if (element.entity() == second)
+                element.get<Transform>().position() =
+                    glm::vec3(0.5f, 0.0f, 0.0f);
+        }
+    }
+    index.update(world);
+
+    result.clear();
+    index.queryRadius(glm::vec3(0.0f), 1.0f, result);
+    ASSERT_EQ(result.size(), 2);
+
+    // Deleted entities are removed from the index
+    world.deleteEntity(first);
+    index.update(world);
+
+    result.clear();
+    index.queryRadius(glm::vec3(0.0f), 1.0f, result);
+    ASSERT_EQ(index.size(), 1);
+    ASSERT_EQ(result.size(), 1);
+    ASSERT_EQ(result[0].id(), second.id());
+
+    index.clear();
+    ASSERT_EQ(index.size(), 0);
+}
+
+TEST(spatial_bounds_test, spatial_test) {
+    World world;
+    SpatialIndex index(2.0f);
+
+    // Large box spanning many cells
+    Entity wall = spawn(world, glm::vec3(20.0f, 0.0f, 0.0f));
+    world.attachComponent<Bounds>(wall, glm::vec3(1.0f, 10.0f, 10.0f));
+
+    Entity small = spawn(world, glm::vec3(10.0f, 0.0f, 0.0f));
+    world.attachComponent<Bounds>(small, glm::vec3(0.5f));
+
+    spawn(world, glm::vec3(0.0f, 5.0f, 0.0f));
+
+    index.update(world);
+
+    // The wall center is far from the query box but its bounds overlap it
+    std::vector<Entity> result;
+    index.queryAabb(
+        glm::vec3(18.0f, 8.0f, 8.0f),
+        glm::vec3(19.5f, 9.0f, 9.0f),
+        result
+    );
+    ASSERT_EQ(result.size(), 1);
+    ASSERT_EQ(result[0].id(), wall.id());
+
+    // The ray hits the small box before the wall
+    auto hit = index.raycast(
+        glm::vec3(0.0f), glm::vec3(2.0f, 0.0f, 0.0f), 100.0f
+    );
+    ASSERT_TRUE(hit.has_value());
+    ASSERT_EQ(hit->entity.id(), small.id());
+    ASSERT_FLOAT_EQ(hit->distance, 9.5f);
+
+    // The ray misses the small box and hits the wall edge
+    hit = index.raycast(
+        glm::vec3(0.0f, 9.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), 100.0f
+    );
+    ASSERT_TRUE(hit.has_value());
+    ASSERT_EQ(hit->entity.id(), wall.id());
+    ASSERT_FLOAT_EQ(hit->distance, 19.0f);
+
+    // The wall is out of range
+    hit = index.raycast(
+        glm::vec3(0.0f, 9.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), 15.0f
+    );
+    ASSERT_FALSE(hit.has_value());
+}
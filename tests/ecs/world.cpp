@@ -3,6 +3,7 @@
 #include "conduit/ecs/world.h"
 #include "conduit/ecs/commandBuffer.h"
 
+#include <thread>
 #include <vector>
 
 using namespace cndt;
@@ -386,3 +387,176 @@ TEST(cmd_buffer_test, world_test) {
         ASSERT_EQ(5, query.size());
     }
 }
+
+// Component larger than the command inline storage
+struct CompLarge {
+    CompLarge() : values{} {};
+    CompLarge(int v) : values{} { values[0] = v; values[31] = v; };
+
+    int values[32];
+};
+
+TEST(cmd_buffer_large_test, world_test) {
+    World world;
+    ECSCmdBuffer cmd_buffer;
+
+    Entity small = world.newEntity();
+    Entity large = world.newEntity();
+
+    CompLarge component(7);
+    cmd_buffer.attachComponent<CompFirst>(small, 3);
+    cmd_buffer.attachComponent<CompLarge>(large, component);
+    world.executeCmdBuffer(cmd_buffer);
+
+    auto query = world.getQuery<CompLarge>();
+    ASSERT_EQ(1, query.size());
+    for (auto element : query) {
+        ASSERT_EQ(large.id(), element.entity().id());
+        ASSERT_EQ(7, element.get<CompLarge>().values[0]);
+        ASSERT_EQ(7, element.get<CompLarge>().values[31]);
+    }
+
+    ASSERT_EQ(1, world.getQuery<CompFirst>().size());
+}
+
+TEST(world_stats_test, world_test) {
+    World world;
+
+    std::vector<Entity> entities;
+    
+    for (int i = 0; i < 20; i++) {
+        Entity e = world.newEntity();
+        entities.push_back(e);
+    }
+    
+    world.deleteEntity(entities.at(3));
+    world.deleteEntity(entities.at(7));
+
+    for (int i = 10; i < 20; i++) {
+        world.attachComponent<CompFirst>(entities.at(i), i);
+        world.attachComponent<CompSecond>(entities.at(i), i);
+    }
+
+    // The query is rebuilt only when the components buffers change
+    world.getQuery<CompFirst, CompSecond>();
+    world.getQuery<CompFirst, CompSecond>();
+    
+    world.detachComponent<CompSecond>(entities.at(10));
+    world.getQuery<CompFirst, CompSecond>();
+
+    WorldStats stats = world.stats();
+
+    ASSERT_EQ(18, stats.entity_count);
+    ASSERT_EQ(2, stats.free_entity_count);
+
+    ASSERT_EQ(2, stats.components.size());
+    for (auto& comp : stats.components) {
+        ASSERT_LE(comp.count, comp.capacity);
+        ASSERT_GT(comp.bytes, 0);
+    }
+    
+    ASSERT_EQ(1, stats.queries.size());
+    ASSERT_EQ(2, stats.queries.at(0).rebuild_count);
+    ASSERT_EQ(9, stats.queries.at(0).element_count);
+}
+
+TEST(world_merge_test, world_test) {
+    World world;
+    
+    // Populate the main world and cache a query on it
+    for (int i = 0; i < 4; i++) {
+        Entity entity = world.newEntity();
+        world.attachComponent<CompFirst>(entity, 1);
+    }
+    ASSERT_EQ(world.getQuery<CompFirst>().size(), 4);
+
+    // Build the streamed world on a different thread
+    World streamed;
+    std::vector<Entity> streamed_entities;
+    
+    std::thread loader([&]() {
+        for (int i = 0; i < 6; i++) {
+            Entity entity = streamed.newEntity();
+            streamed_entities.push_back(entity);
+
+            streamed.attachComponent<CompFirst>(entity, 2);
+            if (i % 2 == 0)
+                streamed.attachComponent<CompSecond>(entity, i);
+        }
+        streamed.deleteEntity(streamed_entities[1]);
+    });
+    loader.join();
+
+    EntityRemap remap = world.merge(std::move(streamed));
+
+    ASSERT_EQ(remap.offset(), 4);
+    ASSERT_EQ(world.stats().entity_count, 9);
+    ASSERT_EQ(streamed.stats().entity_count, 0);
+    ASSERT_TRUE(remap.remap(Entity()).invalid());
+
+    // The merged components are visible from the cached query
+    {
+        auto query = world.getQuery<CompFirst>();
+        ASSERT_EQ(query.size(), 9);
+
+        int sum = 0;
+        for (auto element : query) {
+            sum += element.get<CompFirst>().x;
+        }
+        ASSERT_EQ(sum, 4 + 5 * 2);
+    }
+    {
+        auto query = world.getQuery<CompFirst, CompSecond>();
+        ASSERT_EQ(query.size(), 3);
+
+        auto element = query.find(remap.remap(streamed_entities[2]));
+        ASSERT_NE(element, query.end());
+        ASSERT_EQ((*element).entity().id(), 6);
+    }
+
+    // The freed streamed id is reused by the main world
+    ASSERT_EQ(world.newEntity(), remap.remap(streamed_entities[1]));
+    ASSERT_EQ(streamed.getQuery<CompFirst>().size(), 0);
+}
+
+TEST(world_prefab_test, world_test) {
+    World world;
+
+    Entity first = world.newEntity();
+    world.attachComponent<CompFirst>(first, 1);
+
+    Prefab prefab;
+    prefab.addComponent<CompFirst>(10);
+    prefab.addComponent<CompSecond>(CompSecond(20));
+    prefab.addComponent<CompThird>(30);
+    prefab.removeComponent<CompThird>();
+    ASSERT_EQ(prefab.size(), 2);
+
+    EntityRange range = world.instantiate(prefab, 1000);
+    ASSERT_EQ(range.size(), 1000);
+    ASSERT_EQ(range.firstId(), 1);
+    ASSERT_EQ(range[999].id(), 1000);
+    ASSERT_EQ(world.stats().entity_count, 1001);
+
+    // Instantiate again after the component buffers grew
+    EntityRange second_range = world.instantiate(prefab, 3);
+    ASSERT_EQ(second_range.firstId(), 1001);
+
+    {
+        auto query = world.getQuery<CompFirst>();
+        ASSERT_EQ(query.size(), 1004);
+    }
+    {
+        auto query = world.getQuery<CompFirst, CompSecond>();
+        ASSERT_EQ(query.size(), 1003);
+
+        for (auto element : query) {
+            ASSERT_EQ(element.get<CompFirst>().x, 10);
+            ASSERT_EQ(element.get<CompSecond>().r, 20);
+        }
+    }
+    {
+        auto query = world.getQuery<CompThird>();
+        ASSERT_EQ(query.size(), 0);
+    }
+}
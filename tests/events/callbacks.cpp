@@ -5,6 +5,10 @@
 #include "conduit/events/eventBus.h"
 #include "conduit/events/eventWriter.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 using namespace cndt;
 
 // Override the conduit main function at link time
@@ -209,3 +213,164 @@ TEST(callback_test, multi_update) {
     ASSERT_EQ(int_count, 7);
     ASSERT_EQ(array_count, 7);
 }
+
+TEST(callback_test, parallel_dispatch) {
+    ThreadPool thread_pool(4);
+    
+    EventBus bus;
+    bus.setThreadPool(&thread_pool);
+
+    EventWriter writer = bus.getEventWriter();
+
+    std::atomic<u64> int_sum(0);
+    std::atomic<u64> array_sum(0);
+    u64 serial_count = 0;
+
+    // Thread safe callbacks on two event types
+    bus.addCallback<IntEvent>(
+        [&](const IntEvent* event) { int_sum += event->value; },
+        CallbackMode::ThreadSafe
+    );
+    bus.addCallback<ArrayEvent>(
+        [&](const ArrayEvent* event) { array_sum += event->array[0]; },
+        CallbackMode::ThreadSafe
+    );
+
+    // Serial callbacks always run on the updating thread
+    std::thread::id bus_thread = std::this_thread::get_id();
+    bus.addCallback<IntEvent>(
+        [&](const IntEvent*) { 
+            ASSERT_EQ(std::this_thread::get_id(), bus_thread);
+            serial_count++; 
+        }
+    );
+
+    constexpr u32 event_count = 10000;
+    
+    u64 expected_int_sum = 0;
+    for (u32 i = 0; i < event_count; i++) {
+        writer.send<IntEvent>(IntEvent(i));
+        writer.send<ArrayEvent>(ArrayEvent(2));
+        
+        expected_int_sum += i;
+    }
+
+    bus.update();
+
+    ASSERT_EQ(int_sum, expected_int_sum);
+    ASSERT_EQ(array_sum, 2 * event_count);
+    ASSERT_EQ(serial_count, event_count);
+
+    // Without a thread pool every callback run serially
+    bus.setThreadPool(nullptr);
+    writer.send<IntEvent>(IntEvent(1));
+    bus.update();
+
+    ASSERT_EQ(int_sum, expected_int_sum + 1);
+    ASSERT_EQ(serial_count, event_count + 1);
+}
+
+TEST(callback_test, sparse_types) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+
+    // Register a callback only for the last created event type, 
+    // the register contains null buffers for the other types
+    struct SparseEvent { u32 value; };
+    
+    u64 count = 0;
+    bus.addCallback<SparseEvent>([&](const SparseEvent*) { count++; });
+    
+    writer.send(SparseEvent(1));
+    bus.update();
+
+    ASSERT_EQ(count, 1);
+}
+
+TEST(callback_test, keyed_callbacks) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+
+    struct KeyEvent { u32 key; u32 value; };
+
+    // Keyed callbacks without a key function are ignored
+    u64 ignored_count = 0;
+    bus.addKeyedCallback<KeyEvent>(1, [&](const KeyEvent*) { 
+        ignored_count++; 
+    });
+
+    bus.setEventKey<KeyEvent>([](const KeyEvent& event) -> u64 { 
+        return event.key; 
+    });
+
+    u64 first_sum = 0, second_sum = 0, broadcast_count = 0;
+    bus.addKeyedCallback<KeyEvent>(1, [&](const KeyEvent* event) { 
+        first_sum += event->value; 
+    });
+    bus.addKeyedCallback<KeyEvent>(2, [&](const KeyEvent* event) { 
+        second_sum += event->value; 
+    });
+    bus.addCallback<KeyEvent>([&](const KeyEvent*) { broadcast_count++; });
+
+    for (u32 i = 0; i < 30; i++) {
+        writer.send(KeyEvent(i % 3, i));
+    }
+    bus.update();
+
+    u64 expected_first = 0, expected_second = 0;
+    for (u32 i = 0; i < 30; i++) {
+        if (i % 3 == 1) expected_first += i;
+        if (i % 3 == 2) expected_second += i;
+    }
+
+    ASSERT_EQ(ignored_count, 0);
+    ASSERT_EQ(first_sum, expected_first);
+    ASSERT_EQ(second_sum, expected_second);
+    ASSERT_EQ(broadcast_count, 30);
+}
+
+TEST(callback_test, bus_stats) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+
+    struct StatsEvent { u32 value; };
+    
+    u64 sum = 0;
+    bus.addCallback<StatsEvent>([&](const StatsEvent* event) { 
+        sum += event->value; 
+    });
+
+    // Two updates with a different number of events
+    for (u32 i = 0; i < 20; i++) {
+        writer.send(StatsEvent(i));
+    }
+    bus.update();
+    
+    for (u32 i = 0; i < 5; i++) {
+        writer.send(StatsEvent(i));
+    }
+    bus.update();
+
+    EventBusStats stats = bus.stats();
+    ASSERT_EQ(stats.update_count, 2);
+
+    auto buffer_it = std::find_if(
+        stats.buffers.begin(), 
+        stats.buffers.end(), 
+        [](const EventBufferStats& buffer) {
+            return buffer.type_name == typeid(StatsEvent).name();
+        }
+    );
+    ASSERT_NE(buffer_it, stats.buffers.end());
+
+    ASSERT_EQ(buffer_it->last_update_events, 5);
+    ASSERT_EQ(buffer_it->total_events, 25);
+    ASSERT_EQ(buffer_it->high_water_mark, 20);
+    ASSERT_GE(buffer_it->capacity, 20);
+    ASSERT_EQ(buffer_it->bytes, buffer_it->capacity * sizeof(StatsEvent));
+
+    ASSERT_EQ(stats.callbacks.size(), 1);
+    ASSERT_EQ(stats.callbacks[0].event_count, 25);
+    ASSERT_FALSE(stats.callbacks[0].thread_safe);
+    ASSERT_GE(stats.callbacks[0].total_ns, stats.callbacks[0].max_ns);
+}
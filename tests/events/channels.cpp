@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include "conduit/defines.h"
+
+#include "conduit/events/eventBus.h"
+#include "conduit/events/eventChannel.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/*
+ *
+ *      Define event types
+ *
+ * */
+
+struct IntEvent {
+    IntEvent(u32 value) : value(value) { }
+
+    // Storage value
+    u32 value;
+};
+
+// Read all the events values from a channel reader
+std::vector<u32> readValues(ChannelReader<IntEvent>& reader)
+{
+    std::vector<u32> values;
+    reader.readAll([&](const IntEvent& event) {
+        values.push_back(event.value);
+    });
+
+    return values;
+}
+
+/*
+ *
+ *      Define test functions
+ *
+ * */
+
+TEST(channels_test, drop_oldest) {
+    EventBus bus;
+    bus.createEventChannel<IntEvent>({
+        .capacity = 4,
+        .overflow = ChannelOverflow::DropOldest,
+        .lifetime = 2
+    });
+
+    auto writer = bus.getChannelWriter<IntEvent>();
+    auto reader = bus.getChannelReader<IntEvent>();
+
+    for (u32 i = 0; i < 6; i++) {
+        ASSERT_TRUE(writer.send(IntEvent(i)));
+    }
+
+    ASSERT_EQ(writer.droppedCount(), 2);
+    ASSERT_EQ(reader.availableEvent(), 4);
+    ASSERT_EQ(readValues(reader), std::vector<u32>({2, 3, 4, 5}));
+    ASSERT_EQ(reader.availableEvent(), 0);
+}
+
+TEST(channels_test, drop_newest) {
+    EventBus bus;
+    bus.createEventChannel<IntEvent>({
+        .capacity = 4,
+        .overflow = ChannelOverflow::DropNewest,
+        .lifetime = 2
+    });
+
+    auto writer = bus.getChannelWriter<IntEvent>();
+    auto reader = bus.getChannelReader<IntEvent>();
+
+    for (u32 i = 0; i < 6; i++) {
+        ASSERT_EQ(writer.send(IntEvent(i)), i < 4);
+    }
+
+    ASSERT_EQ(writer.droppedCount(), 2);
+    ASSERT_EQ(readValues(reader), std::vector<u32>({0, 1, 2, 3}));
+}
+
+TEST(channels_test, lifetime) {
+    EventBus bus;
+    bus.createEventChannel<IntEvent>({
+        .capacity = 16,
+        .overflow = ChannelOverflow::DropNewest,
+        .lifetime = 2
+    });
+
+    auto writer = bus.getChannelWriter<IntEvent>();
+    auto first_reader = bus.getChannelReader<IntEvent>();
+    auto second_reader = bus.getChannelReader<IntEvent>();
+
+    writer.send(IntEvent(0));
+    bus.update();
+    writer.send(IntEvent(1));
+
+    // Events are readable for two updates
+    ASSERT_EQ(readValues(first_reader), std::vector<u32>({0, 1}));
+    
+    bus.update();
+    writer.send(IntEvent(2));
+    
+    // The first event expired before the second reader read it
+    ASSERT_EQ(readValues(first_reader), std::vector<u32>({2}));
+    ASSERT_EQ(readValues(second_reader), std::vector<u32>({1, 2}));
+
+    bus.update();
+    bus.update();
+    
+    ASSERT_EQ(first_reader.availableEvent(), 0);
+    ASSERT_EQ(bus.getChannelReader<IntEvent>().availableEvent(), 0);
+}
+
+TEST(channels_test, block) {
+    EventBus bus;
+    bus.createEventChannel<IntEvent>({
+        .capacity = 8,
+        .overflow = ChannelOverflow::Block,
+        .lifetime = 2
+    });
+
+    auto reader = bus.getChannelReader<IntEvent>();
+    
+    constexpr u32 event_count = 1000;
+    std::atomic<bool> done(false);
+
+    // The producer wait for the bus updates when the channel is full
+    std::thread producer([&]() {
+        auto writer = bus.getChannelWriter<IntEvent>();
+
+        for (u32 i = 0; i < event_count; i++) {
+            writer.send(IntEvent(i));
+        }
+
+        done = true;
+    });
+
+    std::vector<u32> values;
+    while (!done || reader.availableEvent() > 0) {
+        auto new_values = readValues(reader);
+        values.insert(values.end(), new_values.begin(), new_values.end());
+
+        bus.update();
+    }
+    producer.join();
+
+    ASSERT_EQ(values.size(), event_count);
+    for (u32 i = 0; i < event_count; i++) {
+        ASSERT_EQ(values[i], i);
+    }
+}
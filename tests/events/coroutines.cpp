@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "conduit/coroutine.h"
+#include "conduit/defines.h"
+
+#include "conduit/events/eventBus.h"
+#include "conduit/events/eventWriter.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+struct InputEvent { 
+    u32 value;
+};
+
+struct OtherEvent { 
+    u32 value;
+};
+
+// Collect all the input events in a loop
+Task collectInputs(EventBus& bus, std::vector<u32>& values)
+{
+    while (true) {
+        InputEvent event = co_await bus.next<InputEvent>();
+        values.push_back(event.value);
+    }
+}
+
+// Wait for an input event, then for two frames
+Task waitSequence(EventBus& bus, u32& state)
+{
+    state = 1;
+    co_await bus.next<InputEvent>();
+    
+    state = 2;
+    co_await nextFrame();
+    co_await nextFrame();
+
+    state = 3;
+}
+
+// Wait for a time interval
+Task waitTime(bool& done)
+{
+    co_await seconds(0.02);
+    done = true;
+}
+
+// Destructor counter stored in a suspended coroutine frame
+struct DestroyCounter {
+    std::shared_ptr<u32> count;
+    ~DestroyCounter() { *count += 1; }
+};
+
+Task waitForever(EventBus& bus, std::shared_ptr<u32> count)
+{
+    DestroyCounter counter { count };
+    co_await bus.next<OtherEvent>();
+}
+
+TEST(coroutines_test, event_awaiter) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+
+    std::vector<u32> values;
+    collectInputs(bus, values);
+    
+    ASSERT_TRUE(values.empty());
+
+    // Every event resumes the waiting coroutine
+    for (u32 i = 0; i < 5; i++) {
+        writer.send(InputEvent(i));
+    }
+    writer.send(OtherEvent(7));
+    bus.update();
+
+    ASSERT_EQ(values, std::vector<u32>({ 0, 1, 2, 3, 4 }));
+
+    // Updates without events don't resume the coroutine
+    bus.update();
+    ASSERT_EQ(values.size(), 5);
+
+    writer.send(InputEvent(9));
+    bus.update();
+    ASSERT_EQ(values.back(), 9);
+}
+
+TEST(coroutines_test, scheduler) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+    
+    CoroutineScheduler scheduler;
+    scheduler.makeCurrent();
+
+    u32 state = 0;
+    waitSequence(bus, state);
+    ASSERT_EQ(state, 1);
+
+    scheduler.update();
+    bus.update();
+    ASSERT_EQ(state, 1);
+
+    writer.send(InputEvent(1));
+    bus.update();
+    ASSERT_EQ(state, 2);
+    ASSERT_EQ(scheduler.size(), 1);
+    
+    scheduler.update();
+    ASSERT_EQ(state, 2);
+    scheduler.update();
+    ASSERT_EQ(state, 3);
+    ASSERT_EQ(scheduler.size(), 0);
+
+    // Time waits are resumed by the first update after the delay
+    bool done = false;
+    waitTime(done);
+    
+    scheduler.update();
+    ASSERT_FALSE(done);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    scheduler.update();
+    ASSERT_TRUE(done);
+}
+
+TEST(coroutines_test, destroy_suspended) {
+    auto count = std::make_shared<u32>(0);
+
+    // The suspended coroutine frames are released with the bus
+    {
+        EventBus bus;
+        waitForever(bus, count);
+        waitForever(bus, count);
+        
+        ASSERT_EQ(*count, 0);
+    }
+
+    ASSERT_EQ(*count, 2);
+}
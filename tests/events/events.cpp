@@ -6,6 +6,10 @@
 #include "conduit/events/eventWriter.h"
 #include "conduit/events/eventReader.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace cndt;
 
 // Override the conduit main function at link time
@@ -332,3 +336,266 @@ TEST(events_test, reader_count) {
     ASSERT_EQ(array_reader.availableEvent(), 0);
 }
 
+
+TEST(events_test, concurrent_send) {
+    EventBus bus;
+
+    auto int_reader = bus.getEventReader<IntEvent>();    
+    
+    constexpr u32 thread_count = 4;
+    constexpr u32 event_count = 20000;
+    
+    // Send events from many threads while the bus is updated
+    std::atomic<u32> done_count(0);
+    std::vector<std::thread> threads;
+
+    for (u32 t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t]() {
+            EventWriter writer = bus.getEventWriter();
+
+            for (u32 i = 0; i < event_count; i++) {
+                writer.sendConcurrent(IntEvent(t * event_count + i));
+            }
+
+            done_count += 1;
+        });
+    }
+
+    std::vector<u32> last_value(thread_count, 0);
+    std::vector<u32> read_count(thread_count, 0);
+
+    auto readEvents = [&]() {
+        for (auto& event : int_reader) {
+            u32 t = event.value / event_count;
+            u32 i = event.value % event_count;
+            
+            // Events from the same thread keep the send order
+            if (read_count[t] > 0) {
+                ASSERT_GT(i, last_value[t]);
+            }
+            
+            last_value[t] = i;
+            read_count[t] += 1;
+        }
+    };
+
+    while (done_count < thread_count) {
+        bus.update();
+        readEvents();
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Concurrent events are published by the next update
+    ASSERT_EQ(int_reader.availableEvent(), 0);
+    bus.update();
+    readEvents();
+
+    for (u32 t = 0; t < thread_count; t++) {
+        ASSERT_EQ(read_count[t], event_count);
+    }
+}
+
+TEST(events_test, typed_writer) {
+    EventBus bus;
+
+    auto int_reader = bus.getEventReader<IntEvent>();    
+    auto array_reader = bus.getEventReader<ArrayEvent>();    
+    
+    auto int_writer = bus.getTypedEventWriter<IntEvent>();
+    auto array_writer = bus.getEventWriter().getTypedWriter<ArrayEvent>();
+
+    // Typed events are visible immediately like the generic writer ones
+    for (u32 i = 0; i < 10; i++) {
+        int_writer.send(IntEvent(test_int + i));
+    }
+    array_writer.send(ArrayEvent(test_array));
+    
+    ASSERT_EQ(int_reader.availableEvent(), 10);
+    ASSERT_EQ(array_reader.availableEvent(), 1);
+
+    u32 i = 0;
+    for (auto& event : int_reader) {
+        ASSERT_EQ(event.value, test_int + i);
+        i++;
+    }
+
+    int_writer.sendConcurrent(IntEvent(test_int));
+    ASSERT_EQ(int_reader.availableEvent(), 0);
+    
+    bus.update();
+    ASSERT_EQ(int_reader.availableEvent(), 1);
+    ASSERT_EQ(array_reader.availableEvent(), 1);
+}
+
+TEST(events_test, batch_read_write) {
+    EventBus bus;
+
+    auto int_reader = bus.getEventReader<IntEvent>();    
+    auto typed_writer = bus.getTypedEventWriter<IntEvent>();
+    EventWriter writer = bus.getEventWriter();
+
+    std::vector<IntEvent> events;
+    for (u32 i = 0; i < 100; i++) {
+        events.push_back(IntEvent(test_int + i));
+    }
+
+    // Send the first half of the events in the previous update
+    writer.sendBatch(std::span<const IntEvent>(events).first(50));
+    bus.update();
+    typed_writer.sendBatch(std::span<const IntEvent>(events).subspan(50));
+
+    // Consume one event before the batch read
+    ASSERT_EQ(int_reader.begin()->value, test_int);
+
+    {
+        auto batch = int_reader.readAll();
+        
+        ASSERT_EQ(batch.size(), 99);
+        ASSERT_EQ(batch.oldEvents().size(), 49);
+        ASSERT_EQ(batch.currentEvents().size(), 50);
+
+        u32 i = 1;
+        batch.forEach([&](const IntEvent& event) {
+            ASSERT_EQ(event.value, test_int + i);
+            i++;
+        });
+    }
+
+    // All the events were consumed
+    ASSERT_EQ(int_reader.availableEvent(), 0);
+    ASSERT_TRUE(int_reader.readAll().empty());
+
+    writer.send(IntEvent(test_int));
+    ASSERT_EQ(int_reader.readAll().currentEvents().size(), 1);
+}
+
+TEST(events_test, coalescing) {
+    EventBus bus;
+
+    struct PositionEvent { u32 x; };
+    struct ScrollEvent { u32 delta; };
+
+    bus.setEventCoalescing<PositionEvent>(EventCoalesce::LastValue);
+    bus.setEventCoalescing<ScrollEvent>(
+        EventCoalesce::Merge,
+        [](ScrollEvent& scroll, const ScrollEvent& event) {
+            scroll.delta += event.delta;
+        }
+    );
+
+    auto position_reader = bus.getEventReader<PositionEvent>();
+    auto scroll_reader = bus.getEventReader<ScrollEvent>();
+    auto int_reader = bus.getEventReader<IntEvent>();
+    EventWriter writer = bus.getEventWriter();
+
+    // High frequency events take one slot per update
+    for (u32 i = 0; i < 100; i++) {
+        writer.send(PositionEvent(i));
+        writer.send(ScrollEvent(1));
+        writer.send(IntEvent(i));
+    }
+
+    ASSERT_EQ(position_reader.availableEvent(), 1);
+    ASSERT_EQ(scroll_reader.availableEvent(), 1);
+    ASSERT_EQ(int_reader.availableEvent(), 100);
+    
+    ASSERT_EQ(position_reader.begin()->x, 99);
+    ASSERT_EQ(scroll_reader.begin()->delta, 100);
+
+    // Events already seen by a reader are never modified
+    writer.send(PositionEvent(200));
+    writer.send(PositionEvent(201));
+    
+    ASSERT_EQ(position_reader.availableEvent(), 1);
+    ASSERT_EQ(position_reader.begin()->x, 201);
+
+    // Concurrent events are coalesced when published
+    bus.update();
+    
+    auto scroll_writer = bus.getTypedEventWriter<ScrollEvent>();
+    for (u32 i = 0; i < 10; i++) {
+        scroll_writer.sendConcurrent(ScrollEvent(2));
+    }
+    writer.send(ScrollEvent(1));
+    
+    bus.update();
+    
+    ASSERT_EQ(scroll_reader.availableEvent(), 1);
+    ASSERT_EQ(scroll_reader.begin()->delta, 21);
+}
+
+TEST(events_test, frozen_buffers) {
+    struct ActiveEvent { u32 value; };
+    struct IdleEvent { u32 value; };
+
+    internal::EventRegister event_register;
+    
+    auto active_buffer = event_register.getEventBuffer<ActiveEvent>().lock();
+    event_register.getEventBuffer<IdleEvent>();
+
+    // The registered buffers start frozen
+    ASSERT_EQ(0, event_register.collectActivated());
+    
+    active_buffer->append(ActiveEvent { 1 });
+    ASSERT_EQ(1, event_register.collectActivated());
+    
+    // The buffer stays active while the event is readable
+    event_register.update();
+    ASSERT_EQ(1, event_register.activeTypes().size());
+    event_register.update();
+    ASSERT_EQ(0, event_register.activeTypes().size());
+
+    // A concurrently sent event activates the frozen buffer
+    active_buffer->appendConcurrent(ActiveEvent { 2 });
+    event_register.publish();
+    ASSERT_EQ(1, event_register.activeTypes().size());
+    ASSERT_EQ(1, active_buffer->getCurrentEvents()->size());
+
+    // Readers keep working across freezing and activation
+    EventBus bus;
+    auto writer = bus.getEventWriter();
+    auto reader = bus.getEventReader<IntEvent>();
+
+    for (u32 i = 0; i < 5; i++) {
+        writer.send(IntEvent { i });
+        bus.update();
+        
+        ASSERT_EQ(reader.availableEvent(), 1);
+        ASSERT_EQ(reader.begin()->value, i);
+
+        // Let the buffer freeze
+        bus.update();
+        bus.update();
+        ASSERT_EQ(reader.availableEvent(), 0);
+    }
+}
+
+TEST(events_test, callback_activation) {
+    struct FirstEvent { u32 value; };
+    struct SecondEvent { u32 value; };
+
+    EventBus bus;
+    auto writer = bus.getEventWriter();
+
+    // Register the second type first so it has the lower type id
+    u32 second_value = 0;
+    bus.addCallback<SecondEvent>([&second_value](const SecondEvent* event) {
+        second_value += event->value;
+    });
+    bus.addCallback<FirstEvent>([&writer](const FirstEvent* event) {
+        writer.send(SecondEvent { event->value * 2 });
+    });
+
+    // The callbacks of the types activated by other callbacks
+    // run during the same update
+    writer.send(FirstEvent { 3 });
+    bus.update();
+    ASSERT_EQ(6, second_value);
+
+    bus.update();
+    bus.update();
+    ASSERT_EQ(6, second_value);
+}
@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include "conduit/defines.h"
+
+#include "conduit/events/eventBus.h"
+#include "conduit/events/events.h"
+#include "conduit/events/eventKeyCode.h"
+#include "conduit/events/inputChannel.h"
+#include "conduit/window/inputState.h"
+
+#include "conduit/internal/core/seqLock.h"
+#include "conduit/internal/core/spscQueue.h"
+
+#include <atomic>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(input_test, spsc_queue) {
+    internal::SpscQueue<u64> queue(100);
+    ASSERT_EQ(128, queue.capacity());
+
+    constexpr u64 value_count = 200000;
+
+    // Push an ordered sequence from a producer thread
+    std::thread producer([&queue]() {
+        for (u64 i = 0; i < value_count; i++) {
+            while (!queue.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    u64 expected = 0;
+    while (expected < value_count) {
+        u64 value;
+        if (queue.pop(value)) {
+            ASSERT_EQ(expected, value);
+            expected++;
+        }
+    }
+
+    producer.join();
+
+    u64 value;
+    ASSERT_FALSE(queue.pop(value));
+    ASSERT_EQ(0, queue.size());
+}
+
+TEST(input_test, channel_drain) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+    auto key_reader = bus.getEventReader<KeyPressEvent>();
+    auto mouse_reader = bus.getEventReader<MousePositionEvent>();
+
+    InputChannel channel(8);
+
+    // Drop the events sent when the channel is full
+    for (u32 i = 0; i < 10; i++) {
+        bool sent = channel.send(KeyPressEvent { .key_code = i, .mods = 0 });
+        ASSERT_EQ(i < 8, sent);
+    }
+    ASSERT_EQ(2, channel.dropped());
+
+    // Events are timestamped in production order
+    f64 last_time = 0.0;
+    usize drained = channel.drain([&](const TimedInputEvent& timed_event) {
+        ASSERT_TRUE(std::holds_alternative<KeyPressEvent>(timed_event.event));
+        ASSERT_LE(last_time, timed_event.time);
+        last_time = timed_event.time;
+    });
+    ASSERT_EQ(8, drained);
+
+    // Drain the events produced by a window thread to the bus
+    std::thread producer([&channel]() {
+        channel.send(KeyPressEvent { .key_code = 42, .mods = 1 });
+        channel.send(MousePositionEvent { .x_pos = 1.0, .y_pos = 2.0 });
+    });
+    producer.join();
+
+    ASSERT_EQ(2, channel.drain(writer));
+    ASSERT_EQ(0, channel.drain(writer));
+    bus.update();
+
+    usize key_count = 0;
+    for (auto& event : key_reader) {
+        ASSERT_EQ(42, event.key_code);
+        ASSERT_EQ(1, event.mods);
+        key_count++;
+    }
+    ASSERT_EQ(1, key_count);
+
+    usize mouse_count = 0;
+    for (auto& event : mouse_reader) {
+        ASSERT_EQ(1.0, event.x_pos);
+        ASSERT_EQ(2.0, event.y_pos);
+        mouse_count++;
+    }
+    ASSERT_EQ(1, mouse_count);
+}
+
+TEST(input_test, input_state) {
+    InputState state;
+
+    // Nothing is published before the first frame
+    ASSERT_FALSE(state.snapshot().isKeyDown(keycode::KEY_W));
+    ASSERT_EQ(0, state.frame());
+
+    state.keyPress(keycode::KEY_W);
+    state.buttonPress(keycode::MOUSE_BUTTON_LEFT);
+    state.mouseMove(10.0, 10.0);
+    state.mouseMove(15.0, 12.0);
+    state.mouseMove(20.0, 8.0);
+    state.scroll(0.0, 1.0);
+    state.scroll(0.0, 2.0);
+
+    // Ignore the key codes outside the tracked range
+    state.keyPress(static_cast<u32>(-1));
+
+    // The pending input is visible only after the publish
+    ASSERT_FALSE(state.snapshot().isKeyDown(keycode::KEY_W));
+    state.publish();
+
+    InputSnapshot first = state.snapshot();
+    ASSERT_EQ(1, state.frame());
+    ASSERT_EQ(0, first.frame);
+    ASSERT_TRUE(first.isKeyDown(keycode::KEY_W));
+    ASSERT_TRUE(first.isKeyPressed(keycode::KEY_W));
+    ASSERT_FALSE(first.isKeyReleased(keycode::KEY_W));
+    ASSERT_TRUE(first.isButtonPressed(keycode::MOUSE_BUTTON_LEFT));
+    ASSERT_FALSE(first.isKeyDown(static_cast<u32>(-1)));
+    ASSERT_EQ(20.0, first.mouse_x);
+    ASSERT_EQ(10.0, first.mouse_delta_x);
+    ASSERT_EQ(-2.0, first.mouse_delta_y);
+    ASSERT_EQ(3.0, first.scroll_y);
+
+    // Held keys carry over, edges and deltas are reset
+    state.keyRelease(keycode::KEY_A);
+    state.publish();
+
+    InputSnapshot second = state.snapshot();
+    ASSERT_EQ(1, second.frame);
+    ASSERT_TRUE(second.isKeyDown(keycode::KEY_W));
+    ASSERT_FALSE(second.isKeyPressed(keycode::KEY_W));
+    ASSERT_TRUE(second.isButtonDown(keycode::MOUSE_BUTTON_LEFT));
+    ASSERT_EQ(0.0, second.mouse_delta_x);
+    ASSERT_EQ(0.0, second.scroll_y);
+    ASSERT_EQ(20.0, second.mouse_x);
+
+    // Losing the focus releases everything
+    state.releaseAll();
+    state.publish();
+
+    InputSnapshot third = state.snapshot();
+    ASSERT_FALSE(third.isKeyDown(keycode::KEY_W));
+    ASSERT_TRUE(third.isKeyReleased(keycode::KEY_W));
+    ASSERT_TRUE(third.isButtonReleased(keycode::MOUSE_BUTTON_LEFT));
+}
+
+TEST(input_test, seq_lock) {
+    struct Value {
+        u64 a;
+        u64 b;
+        u64 c;
+    };
+
+    internal::SeqLock<Value> value(Value { 0, 0, 0 });
+    std::atomic<bool> done = false;
+
+    // Readers must always see a value written by a single store
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; i++) {
+        readers.emplace_back([&value, &done]() {
+            while (!done.load()) {
+                Value read = value.load();
+                ASSERT_EQ(read.a, read.b);
+                ASSERT_EQ(read.a, read.c);
+            }
+        });
+    }
+
+    for (u64 i = 1; i <= 100000; i++) {
+        value.store(Value { i, i, i });
+    }
+    done = true;
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_EQ(100000, value.load().a);
+    ASSERT_EQ(100000, value.version());
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "conduit/defines.h"
+
+#include "conduit/events/eventBus.h"
+#include "conduit/events/eventReader.h"
+#include "conduit/events/eventRecorder.h"
+#include "conduit/events/eventWriter.h"
+#include "conduit/events/events.h"
+
+#include <filesystem>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// User event type recorded with a user tag
+struct ScoreEvent { 
+    u32 player;
+    f32 score;
+};
+
+TEST(recorder_test, record_replay) {
+    auto log_path = std::filesystem::temp_directory_path() / 
+        "conduit_recorder_test.cndev";
+
+    // Record three frames of events
+    {
+        EventBus bus;
+        EventWriter writer = bus.getEventWriter();
+        
+        EventRecorder recorder(bus);
+        recorder.recordEngineEvents();
+        recorder.recordType<ScoreEvent>(eventtag::USER);
+        
+        ASSERT_TRUE(recorder.start(log_path));
+
+        writer.send(KeyPressEvent(65, 0));
+        writer.send(MousePositionEvent(10.0, 20.0));
+        bus.update();
+        recorder.update();
+
+        // Empty frame
+        bus.update();
+        recorder.update();
+        
+        writer.send(ScoreEvent(2, 4.5f));
+        writer.send(WindowCloseEvent());
+        bus.update();
+        recorder.update();
+
+        recorder.stop();
+    }
+
+    // Replay the log on a new bus
+    EventBus bus;
+    
+    EventPlayer player(bus.getEventWriter());
+    player.registerEngineEvents();
+    player.registerType<ScoreEvent>(eventtag::USER);
+    
+    ASSERT_TRUE(player.open(log_path));
+    
+    auto key_reader = bus.getEventReader<KeyPressEvent>();
+    auto mouse_reader = bus.getEventReader<MousePositionEvent>();
+    auto score_reader = bus.getEventReader<ScoreEvent>();
+    auto close_reader = bus.getEventReader<WindowCloseEvent>();
+
+    // First frame
+    player.update();
+    
+    ASSERT_EQ(key_reader.availableEvent(), 1);
+    ASSERT_EQ(key_reader.begin()->key_code, 65);
+    ASSERT_EQ(mouse_reader.availableEvent(), 1);
+    ASSERT_EQ(mouse_reader.begin()->y_pos, 20.0);
+    ASSERT_EQ(score_reader.availableEvent(), 0);
+    bus.update();
+
+    // Second frame
+    player.update();
+    
+    ASSERT_EQ(score_reader.availableEvent(), 0);
+    ASSERT_FALSE(player.finished());
+    bus.update();
+
+    // Third frame
+    player.update();
+    
+    ASSERT_EQ(score_reader.availableEvent(), 1);
+    
+    ScoreEvent score = *score_reader.begin();
+    ASSERT_EQ(score.player, 2);
+    ASSERT_EQ(score.score, 4.5f);
+    ASSERT_EQ(close_reader.availableEvent(), 1);
+    ASSERT_TRUE(player.finished());
+
+    std::filesystem::remove(log_path);
+}
+
+TEST(recorder_test, invalid_log) {
+    EventBus bus;
+    EventPlayer player(bus.getEventWriter());
+
+    ASSERT_FALSE(player.open("conduit_missing_event_log.cndev"));
+    ASSERT_TRUE(player.finished());
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include "conduit/defines.h"
+
+#include "conduit/events/eventBus.h"
+#include "conduit/events/eventReader.h"
+#include "conduit/events/eventWriter.h"
+
+#include "conduit/internal/events/timerWheel.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace cndt;
+
+// Override the conduit main function at link time
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+struct TimerEvent { 
+    u32 value;
+};
+
+TEST(timers_test, timer_wheel) {
+    internal::TimerWheel wheel;
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<u64> expiry_dist(0, 300000);
+
+    // Schedule timers across all the wheel levels
+    constexpr usize timer_count = 2000;
+    
+    std::vector<u64> expiries(timer_count);
+    std::vector<u64> fired_at(timer_count, 0);
+    std::vector<bool> fired(timer_count, false);
+    std::vector<internal::TimerWheel::TimerId> ids(timer_count);
+
+    u64 current = 0;
+    for (usize i = 0; i < timer_count; i++) {
+        expiries[i] = expiry_dist(rng);
+        ids[i] = wheel.schedule(expiries[i], [&, i]() {
+            fired[i] = true;
+            fired_at[i] = current;
+        });
+    }
+
+    // Cancel every tenth timer
+    for (usize i = 0; i < timer_count; i += 10) {
+        ASSERT_TRUE(wheel.cancel(ids[i]));
+        ASSERT_FALSE(wheel.cancel(ids[i]));
+    }
+    ASSERT_EQ(wheel.size(), timer_count - timer_count / 10);
+
+    // Advance with irregular steps
+    std::uniform_int_distribution<u64> step_dist(1, 700);
+    while (current < 300000) {
+        current += step_dist(rng);
+        wheel.advance(current);
+    }
+
+    for (usize i = 0; i < timer_count; i++) {
+        if (i % 10 == 0) {
+            ASSERT_FALSE(fired[i]);
+            continue;
+        }
+
+        // Timers fire in the first advance reaching their expiry
+        ASSERT_TRUE(fired[i]);
+        ASSERT_GE(fired_at[i], expiries[i]);
+        ASSERT_LT(fired_at[i] - expiries[i], 700);
+        ASSERT_FALSE(wheel.pending(ids[i]));
+    }
+
+    ASSERT_EQ(wheel.size(), 0);
+}
+
+TEST(timers_test, send_at) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+    
+    u64 fired = 0;
+    bus.addCallback<TimerEvent>([&](const TimerEvent*) { fired++; });
+
+    // Sent at the third update
+    writer.sendAt(TimerEvent(1), bus.updateCount() + 2);
+    TimerHandle canceled = writer.sendAt(TimerEvent(2), 2);
+    
+    ASSERT_TRUE(canceled.pending());
+    ASSERT_TRUE(canceled.cancel());
+    ASSERT_FALSE(canceled.pending());
+
+    bus.update();
+    bus.update();
+    ASSERT_EQ(fired, 0);
+    
+    bus.update();
+    ASSERT_EQ(fired, 1);
+
+    // Already reached updates are sent at the next update
+    writer.sendAt(TimerEvent(3), 0);
+    bus.update();
+    ASSERT_EQ(fired, 2);
+
+    // Empty handles can't cancel anything
+    TimerHandle empty;
+    ASSERT_FALSE(empty.cancel());
+    ASSERT_FALSE(empty.pending());
+}
+
+TEST(timers_test, send_delayed) {
+    EventBus bus;
+    EventWriter writer = bus.getEventWriter();
+    
+    auto reader = bus.getEventReader<TimerEvent>();
+
+    TimerHandle handle = writer.sendDelayed(TimerEvent(42), 0.02);
+    writer.sendDelayed(TimerEvent(7), 3600.0).cancel();
+    
+    bus.update();
+    ASSERT_TRUE(handle.pending());
+    ASSERT_EQ(reader.availableEvent(), 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    bus.update();
+
+    ASSERT_FALSE(handle.pending());
+    ASSERT_EQ(reader.availableEvent(), 1);
+    ASSERT_EQ(reader.begin()->value, 42);
+}